@@ -82,6 +82,7 @@ private:
   unsigned short ConvCriteria;	/*!< \brief Kind of convergence criteria. */
   unsigned short nFFD_Iter; 	/*!< \brief Iteration for the point inversion problem. */
   su2double FFD_Tol;  	/*!< \brief Tolerance in the point inversion problem. */
+  bool FFD_ParamCache;  /*!< \brief Read/write the parametric coordinates of the point inversion from/to a file. */
   bool Viscous_Limiter_Flow, Viscous_Limiter_Turb;			/*!< \brief Viscous limiters. */
   bool Write_Conv_FSI;			/*!< \brief Write convergence file for FSI problems. */
   bool ContinuousAdjoint,			/*!< \brief Flag to know if the code is solving an adjoint problem. */
@@ -421,6 +422,14 @@ private:
   su2double Deform_Tol_Factor; /*!< Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff; /*!< Deform coeffienct */
   unsigned short Deform_Linear_Solver; /*!< Numerical method to deform the grid */
+  unsigned short Deform_Linear_Solver_Prec; /*!< \brief Preconditioner of the linear solver of the grid deformation. */
+  bool Deform_Warm_Start,             /*!< \brief Previous displacement field as the initial guess of the grid deformation. */
+  Deform_Frozen_Stiffness;            /*!< \brief Stiffness matrix of the grid deformation assembled only on the reference mesh. */
+  unsigned short Deform_Kind,         /*!< \brief Method of the volumetric grid deformation. */
+  Deform_RBF_Function;                /*!< \brief Radial basis function of the RBF grid deformation. */
+  su2double Deform_RBF_Radius,        /*!< \brief Support radius of the radial basis functions. */
+  Deform_RBF_Tolerance;               /*!< \brief Tolerance of the greedy selection of the RBF control points. */
+  unsigned long Deform_RBF_MaxPoints; /*!< \brief Maximum number of RBF control points. */
   unsigned short FFD_Continuity; /*!< Surface continuity at the intersection with the FFD */
   su2double Deform_ElasticityMod, Deform_PoissonRatio; /*!< young's modulus and poisson ratio for volume deformation stiffness model */
   bool Visualize_Deformation;	/*!< \brief Flag to visualize the deformation in MDC. */
@@ -446,6 +455,24 @@ private:
 	Wrt_Sol_Freq_DualTime,	/*!< \brief Writing solution frequency for Dual Time. */
 	Wrt_Con_Freq,				/*!< \brief Writing convergence history frequency. */
 	Wrt_Con_Freq_DualTime;				/*!< \brief Writing convergence history frequency. */
+  su2double Wrt_Sol_WallTime;   /*!< \brief Wall-clock time between checkpoints (minutes). */
+  bool Checkpoint_Signal,   /*!< \brief Write the solution and stop when SIGTERM or SIGUSR1 is received. */
+  Wrt_Restart_Backup;       /*!< \brief Keep the previous restart file as a backup. */
+  bool Unsteady_History;    /*!< \brief Store the unsteady restarts in a single container file. */
+  unsigned short Kind_History_Compression;  /*!< \brief Compression of the unsteady history. */
+  su2double History_Tolerance;  /*!< \brief Relative error bound of the lossy compression of the unsteady history. */
+  unsigned long History_Steps;  /*!< \brief Time steps per unsteady history file. */
+  unsigned short nSample_Probes,  /*!< \brief Number of values of the sampling probes. */
+  nSample_Lines,                  /*!< \brief Number of values of the sampling lines. */
+  nSample_Planes,                 /*!< \brief Number of values of the sampling planes. */
+  nMarker_Sample;                 /*!< \brief Number of sampled markers. */
+  su2double *Sample_Probes,       /*!< \brief Coordinates of the sampling probes. */
+  *Sample_Lines,                  /*!< \brief Definition of the sampling lines. */
+  *Sample_Planes;                 /*!< \brief Definition of the sampling planes. */
+  string *Marker_Sample;          /*!< \brief Sampled markers. */
+  unsigned long Sample_Freq,      /*!< \brief Sampling frequency. */
+  Sample_Buffer;                  /*!< \brief Number of samples kept in memory before they are written. */
+  string Sample_FileName;         /*!< \brief Output file of the samples. */
 	bool Wrt_Unsteady;  /*!< \brief Write unsteady data adding header and prefix. */
   bool Wrt_Dynamic;  		/*!< \brief Write dynamic data adding header and prefix. */
 	bool LowFidelitySim;  /*!< \brief Compute a low fidelity simulation. */
@@ -488,6 +515,7 @@ private:
 	unsigned short Axis_Orientation;	/*!< \brief Axis orientation. */
 	unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
 	unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
+  unsigned short Runtime_Command;	/*!< \brief Command read from the runtime control file. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
 	su2double RefAreaCoeff,		/*!< \brief Reference area for coefficient computation. */
 	RefElemLength,				/*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -519,6 +547,7 @@ private:
 	AdjWave_FileName,					/*!< \brief Adjoint wave variables output file. */
 	Residual_FileName,				/*!< \brief Residual variables output file. */
 	Conv_FileName,					/*!< \brief Convergence history output file. */
+  Runtime_FileName,       /*!< \brief Runtime control file. */
   Breakdown_FileName,			    /*!< \brief Breakdown output file. */
   Conv_FileName_FSI,					/*!< \brief Convergence history output file. */
   Restart_FlowFileName,			/*!< \brief Restart file for flow variables. */
@@ -535,6 +564,7 @@ private:
   SurfSens_FileName,			/*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName;			/*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
 	bool Low_MemoryOutput,      /*!< \brief Write a volume solution file */
+  Output_Compression,         /*!< \brief Compress the data blocks of binary output files */
   Wrt_Vol_Sol,                /*!< \brief Write a volume solution file */
 	Wrt_Srf_Sol,                /*!< \brief Write a surface solution file */
 	Wrt_Csv_Sol,                /*!< \brief Write a surface comma-separated values solution file */
@@ -610,6 +640,15 @@ private:
 	su2double AitkenStatRelax;			/*!< \brief Aitken's relaxation factor (if set as static) */
 	su2double AitkenDynMaxInit;			/*!< \brief Aitken's maximum dynamic relaxation factor for the first iteration */
 	su2double AitkenDynMinInit;			/*!< \brief Aitken's minimum dynamic relaxation factor for the first iteration */
+	unsigned short IQN_WindowSize;		/*!< \brief Maximum number of secant pairs of the interface quasi-Newton method. */
+	unsigned short IQN_ReuseTimeSteps;	/*!< \brief Number of previous time steps whose secant pairs are reused by the interface quasi-Newton method. */
+	bool FluidModel_LUT;		/*!< \brief Interpolate the real gas fluid model from look-up tables. */
+	string LUT_FileName;		/*!< \brief Name of the file with the look-up tables of the fluid model. */
+	unsigned long LUT_nPoints;		/*!< \brief Number of nodes per direction of the look-up tables. */
+	su2double LUT_Pressure_Min,		/*!< \brief Lower bound of the pressure range of the look-up tables. */
+	LUT_Pressure_Max,		/*!< \brief Upper bound of the pressure range of the look-up tables. */
+	LUT_Temperature_Min,		/*!< \brief Lower bound of the temperature range of the look-up tables. */
+	LUT_Temperature_Max;		/*!< \brief Upper bound of the temperature range of the look-up tables. */
 	su2double Wave_Speed;			/*!< \brief Wave speed used in the wave solver. */
 	su2double Thermal_Diffusivity;			/*!< \brief Thermal diffusivity used in the heat solver. */
 	su2double Cyclic_Pitch,          /*!< \brief Cyclic pitch for rotorcraft simulations. */
@@ -705,6 +744,9 @@ private:
   su2double Static_Time;			/*!< \brief Time while the structure is not loaded in FSI applications. */
   unsigned short Pred_Order;  /*!< \brief Order of the predictor for FSI applications. */
   unsigned short Kind_Interpolation; /*!\brief type of interpolation to use for FSI applications. */
+  bool ConservativeInterpolation; /*!\brief Transfer the loads with the transpose of the displacement interpolation. */
+  unsigned short Interpolation_RBF_Function, /*!\brief Radial basis function of the RBF interpolation. */
+  Interpolation_RBF_Points; /*!\brief Number of donor points of the RBF interpolation of each target point. */
   bool Prestretch;             /*!< Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;         /*!< \brief File name for reference geometry. */
   unsigned long Nonphys_Points, /*!< \brief Current number of non-physical points in the solution. */
@@ -2006,6 +2048,18 @@ public:
 	 */
 	void SetCFL(unsigned short val_mesh, su2double val_cfl);
 
+  /*!
+	 * \brief Get the Courant Friedrich Levi number of the finest grid, as given in the config file.
+	 * \return CFL number of the finest grid.
+	 */
+	su2double GetCFL_FineGrid(void);
+
+  /*!
+	 * \brief Set the Courant Friedrich Levi number of the finest grid and update all the grid levels.
+	 * \param[in] val_cfl - CFL number of the finest grid.
+	 */
+	void SetCFL_FineGrid(su2double val_cfl);
+
 	/*!
 	 * \brief Get the Courant Friedrich Levi number for unsteady simulations.
 	 * \return CFL number for unsteady simulations.
@@ -2275,6 +2329,121 @@ public:
 	 */
 	unsigned long GetWrt_Sol_Freq_DualTime(void);
 
+  /*!
+	 * \brief Get the wall-clock time between checkpoints.
+	 * \return Wall-clock time between checkpoints in minutes (0 if disabled).
+	 */
+	su2double GetWrt_Sol_WallTime(void);
+
+  /*!
+	 * \brief Get information about the checkpoint triggered by signals.
+	 * \return <code>TRUE</code> if SIGTERM and SIGUSR1 write the solution and stop the simulation.
+	 */
+	bool GetCheckpoint_Signal(void);
+
+  /*!
+	 * \brief Get information about the backup of the restart files.
+	 * \return <code>TRUE</code> if the restart files are written through a temporary file, keeping the previous one.
+	 */
+	bool GetWrt_Restart_Backup(void);
+
+  /*!
+	 * \brief Get information about the unsteady history container.
+	 * \return <code>TRUE</code> if the unsteady flow restarts are stored in a single container file.
+	 */
+	bool GetUnsteady_History(void);
+
+  /*!
+	 * \brief Get the compression of the unsteady history.
+	 * \return Compression of the unsteady history (see ENUM_HISTORY_COMPRESSION).
+	 */
+	unsigned short GetKind_History_Compression(void);
+
+  /*!
+	 * \brief Get the relative error bound of the lossy compression of the unsteady history.
+	 * \return Relative error bound.
+	 */
+	su2double GetHistory_Tolerance(void);
+
+  /*!
+	 * \brief Get the number of time steps per unsteady history file.
+	 * \return Time steps per file (0 for a single file).
+	 */
+	unsigned long GetHistory_Steps(void);
+
+  /*!
+	 * \brief Get the number of values that define the sampling probes (three per probe).
+	 * \return Number of values.
+	 */
+	unsigned short GetnSample_Probes(void);
+
+  /*!
+	 * \brief Get the coordinates of the sampling probes.
+	 * \return Coordinates of the probes (x, y, z for each probe).
+	 */
+	su2double *GetSample_Probes(void);
+
+  /*!
+	 * \brief Get the number of values that define the sampling lines (seven per line).
+	 * \return Number of values.
+	 */
+	unsigned short GetnSample_Lines(void);
+
+  /*!
+	 * \brief Get the definition of the sampling lines.
+	 * \return Start and end points, and number of points of each line.
+	 */
+	su2double *GetSample_Lines(void);
+
+  /*!
+	 * \brief Get the number of values that define the sampling planes (eleven per plane).
+	 * \return Number of values.
+	 */
+	unsigned short GetnSample_Planes(void);
+
+  /*!
+	 * \brief Get the definition of the sampling planes.
+	 * \return Origin, edges and number of points along each edge of each plane.
+	 */
+	su2double *GetSample_Planes(void);
+
+  /*!
+	 * \brief Get the number of sampled markers.
+	 * \return Number of sampled markers.
+	 */
+	unsigned short GetnMarker_Sample(void);
+
+  /*!
+	 * \brief Get the name of a sampled marker.
+	 * \param[in] val_marker - Index of the sampled marker.
+	 * \return Name of the marker.
+	 */
+	string GetMarker_Sample(unsigned short val_marker);
+
+  /*!
+	 * \brief Get the sampling frequency.
+	 * \return Iterations between two samples.
+	 */
+	unsigned long GetSample_Freq(void);
+
+  /*!
+	 * \brief Get the number of samples kept in memory before they are written.
+	 * \return Number of buffered samples.
+	 */
+	unsigned long GetSample_Buffer(void);
+
+  /*!
+	 * \brief Get the name of the output file of the samples.
+	 * \return Name of the file.
+	 */
+	string GetSample_FileName(void);
+
+  /*!
+	 * \brief Get information about the sampling of the flow solution.
+	 * \return <code>TRUE</code> if there are probes, lines, planes or markers to sample.
+	 */
+	bool GetSampling(void);
+
 	/*!
 	 * \brief Get the frequency for writing the convergence file.
 	 * \return It writes the convergence file with this frequency.
@@ -2311,6 +2480,12 @@ public:
 	 */
   bool GetLow_MemoryOutput(void);
 
+  /*!
+	 * \brief Get information about compressing the data blocks of binary output files.
+	 * \return <code>TRUE</code> means that the data blocks are compressed with zlib.
+	 */
+  bool GetOutput_Compression(void);
+
 	/*!
 	 * \brief Get information about writing a surface solution file.
 	 * \return <code>TRUE</code> means that a surface solution file will be written.
@@ -2708,6 +2883,48 @@ public:
 	 */
 	su2double GetAcentric_Factor(void);
 
+	/*!
+	 * \brief Get whether the fluid model is interpolated from look-up tables.
+	 * \return <code>TRUE</code> if the real gas model is replaced by its look-up tables.
+	 */
+	bool GetFluidModel_LUT(void);
+
+	/*!
+	 * \brief Get the name of the file with the look-up tables of the fluid model.
+	 * \return Name of the file.
+	 */
+	string GetLUT_FileName(void);
+
+	/*!
+	 * \brief Get the number of nodes per direction of the look-up tables.
+	 * \return Number of nodes.
+	 */
+	unsigned long GetLUT_nPoints(void);
+
+	/*!
+	 * \brief Get the lower bound of the pressure range of the look-up tables.
+	 * \return Pressure (0.0 for a range based on the free-stream pressure).
+	 */
+	su2double GetLUT_Pressure_Min(void);
+
+	/*!
+	 * \brief Get the upper bound of the pressure range of the look-up tables.
+	 * \return Pressure (0.0 for a range based on the free-stream pressure).
+	 */
+	su2double GetLUT_Pressure_Max(void);
+
+	/*!
+	 * \brief Get the lower bound of the temperature range of the look-up tables.
+	 * \return Temperature (0.0 for a range based on the free-stream temperature).
+	 */
+	su2double GetLUT_Temperature_Min(void);
+
+	/*!
+	 * \brief Get the upper bound of the temperature range of the look-up tables.
+	 * \return Temperature (0.0 for a range based on the free-stream temperature).
+	 */
+	su2double GetLUT_Temperature_Max(void);
+
 	/*!
 	 * \brief Get the value of the critical temperature.
 	 * \return Critical temperature.
@@ -2798,6 +3015,54 @@ public:
    */
   unsigned short GetDeform_Linear_Solver(void);
 
+  /*!
+   * \brief Get the kind of preconditioner of the linear solver of the grid deformation.
+   * \return Preconditioner of the grid deformation (see ENUM_LINEAR_SOLVER_PREC).
+   */
+  unsigned short GetDeform_Linear_Solver_Prec(void);
+
+  /*!
+   * \brief Check if the previous displacement field is the initial guess of the grid deformation.
+   * \return <code>TRUE</code> if the linear solver of the grid deformation is warm started.
+   */
+  bool GetDeform_Warm_Start(void);
+
+  /*!
+   * \brief Check if the stiffness matrix of the grid deformation is only assembled on the reference mesh.
+   * \return <code>TRUE</code> if the stiffness matrix and its preconditioner are reused.
+   */
+  bool GetDeform_Frozen_Stiffness(void);
+
+  /*!
+   * \brief Get the method of the volumetric grid deformation.
+   * \return Method of the grid deformation (see ENUM_DEFORM_KIND).
+   */
+  unsigned short GetDeform_Kind(void);
+
+  /*!
+   * \brief Get the radial basis function of the RBF grid deformation.
+   * \return Radial basis function (see ENUM_RADIALBASIS).
+   */
+  unsigned short GetDeform_RBF_Function(void);
+
+  /*!
+   * \brief Get the support radius of the radial basis functions.
+   * \return Support radius (0.0, the size of the boundary).
+   */
+  su2double GetDeform_RBF_Radius(void);
+
+  /*!
+   * \brief Get the tolerance of the greedy selection of the RBF control points.
+   * \return Tolerance, relative to the maximum displacement of the boundary.
+   */
+  su2double GetDeform_RBF_Tolerance(void);
+
+  /*!
+   * \brief Get the maximum number of RBF control points.
+   * \return Maximum number of control points (0, no limit).
+   */
+  unsigned long GetDeform_RBF_MaxPoints(void);
+
 	/*!
 	 * \brief Get the kind of preconditioner for the implicit solver.
 	 * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -3809,6 +4074,18 @@ public:
 	 */
 	string GetConv_FileName(void);
 
+  /*!
+	 * \brief Get the name of the runtime control file.
+	 * \return Name of the runtime control file.
+	 */
+	string GetRuntime_FileName(void);
+
+  /*!
+	 * \brief Get the command given in the runtime control file.
+	 * \return Runtime command (see ENUM_RUNTIME_COMMAND).
+	 */
+	unsigned short GetRuntime_Command(void);
+
 	/*!
 	 * \brief Get the name of the file with the convergence history of the problem for FSI applications.
 	 * \return Name of the file with convergence history of the problem.
@@ -5249,6 +5526,12 @@ public:
 	 */
 	su2double GetFFD_Tol(void);
 
+  /*!
+	 * \brief Get whether the parametric coordinates of the FFD point inversion are cached in a file.
+	 * \return <code>TRUE</code> if the parametric coordinates are read from (or written to) the cache file.
+	 */
+	bool GetFFD_ParamCache(void);
+
   /*!
 	 * \brief Get the node number of the CV to visualize.
 	 * \return Node number of the CV to visualize.
@@ -5384,6 +5667,18 @@ public:
 	 */
 	su2double GetAitkenDynMinInit(void);
 
+	/*!
+	 * \brief Get the maximum number of secant pairs kept by the interface quasi-Newton method.
+	 * \return Size of the window.
+	 */
+	unsigned short GetIQN_WindowSize(void);
+
+	/*!
+	 * \brief Get the number of previous time steps whose secant pairs are reused by the interface quasi-Newton method.
+	 * \return Number of time steps.
+	 */
+	unsigned short GetIQN_ReuseTimeSteps(void);
+
 
 	/*!
 	  * \brief Decide whether to apply dead loads to the model.
@@ -5543,6 +5838,21 @@ public:
 	 */
 	inline unsigned short GetKindInterpolation(void);
 
+	/*!
+	 * \brief Get whether the loads are transferred with the transpose of the displacement interpolation.
+	 */
+	inline bool GetConservativeInterpolation(void);
+
+	/*!
+	 * \brief Get the radial basis function of the RBF interpolation between zones.
+	 */
+	inline unsigned short GetInterpolation_RBF_Function(void);
+
+	/*!
+	 * \brief Get the number of donor points of the RBF interpolation (0 for the default).
+	 */
+	inline unsigned short GetInterpolation_RBF_Points(void);
+
   /*!
    * \brief Get the AD support.
    */
@@ -398,6 +398,8 @@ inline su2double CConfig::GetCFL(unsigned short val_mesh) {	return CFL[val_mesh]
 
 inline void CConfig::SetCFL(unsigned short val_mesh, su2double val_cfl) { CFL[val_mesh] = val_cfl; }
 
+inline su2double CConfig::GetCFL_FineGrid(void) { return CFLFineGrid; }
+
 inline su2double CConfig::GetUnst_CFL(void) {	return Unst_CFL; }
 
 inline su2double CConfig::GetMax_DeltaTime(void) {	return Max_DeltaTime; }
@@ -443,6 +445,44 @@ inline unsigned long CConfig::GetWrt_Sol_Freq(void) { return Wrt_Sol_Freq; }
 
 inline unsigned long CConfig::GetWrt_Sol_Freq_DualTime(void) { return Wrt_Sol_Freq_DualTime; }
 
+inline su2double CConfig::GetWrt_Sol_WallTime(void) { return Wrt_Sol_WallTime; }
+
+inline bool CConfig::GetCheckpoint_Signal(void) { return Checkpoint_Signal; }
+
+inline bool CConfig::GetWrt_Restart_Backup(void) { return Wrt_Restart_Backup; }
+
+inline bool CConfig::GetUnsteady_History(void) { return Unsteady_History; }
+
+inline unsigned short CConfig::GetKind_History_Compression(void) { return Kind_History_Compression; }
+
+inline su2double CConfig::GetHistory_Tolerance(void) { return History_Tolerance; }
+
+inline unsigned long CConfig::GetHistory_Steps(void) { return History_Steps; }
+
+inline unsigned short CConfig::GetnSample_Probes(void) { return nSample_Probes; }
+
+inline su2double* CConfig::GetSample_Probes(void) { return Sample_Probes; }
+
+inline unsigned short CConfig::GetnSample_Lines(void) { return nSample_Lines; }
+
+inline su2double* CConfig::GetSample_Lines(void) { return Sample_Lines; }
+
+inline unsigned short CConfig::GetnSample_Planes(void) { return nSample_Planes; }
+
+inline su2double* CConfig::GetSample_Planes(void) { return Sample_Planes; }
+
+inline unsigned short CConfig::GetnMarker_Sample(void) { return nMarker_Sample; }
+
+inline string CConfig::GetMarker_Sample(unsigned short val_marker) { return Marker_Sample[val_marker]; }
+
+inline unsigned long CConfig::GetSample_Freq(void) { return Sample_Freq; }
+
+inline unsigned long CConfig::GetSample_Buffer(void) { return Sample_Buffer; }
+
+inline string CConfig::GetSample_FileName(void) { return Sample_FileName; }
+
+inline bool CConfig::GetSampling(void) { return ((nSample_Probes + nSample_Lines + nSample_Planes + nMarker_Sample) > 0); }
+
 inline unsigned long CConfig::GetWrt_Con_Freq(void) { return Wrt_Con_Freq; }
 
 inline unsigned long CConfig::GetWrt_Con_Freq_DualTime(void) { return Wrt_Con_Freq_DualTime; }
@@ -475,6 +515,20 @@ inline su2double CConfig::GetTemperature_Critical(void) { return Temperature_Cri
 
 inline su2double CConfig::GetAcentric_Factor(void) { return Acentric_Factor; }
 
+inline bool CConfig::GetFluidModel_LUT(void) { return FluidModel_LUT; }
+
+inline string CConfig::GetLUT_FileName(void) { return LUT_FileName; }
+
+inline unsigned long CConfig::GetLUT_nPoints(void) { return LUT_nPoints; }
+
+inline su2double CConfig::GetLUT_Pressure_Min(void) { return LUT_Pressure_Min; }
+
+inline su2double CConfig::GetLUT_Pressure_Max(void) { return LUT_Pressure_Max; }
+
+inline su2double CConfig::GetLUT_Temperature_Min(void) { return LUT_Temperature_Min; }
+
+inline su2double CConfig::GetLUT_Temperature_Max(void) { return LUT_Temperature_Max; }
+
 inline unsigned short CConfig::GetKind_ViscosityModel(void) { return Kind_ViscosityModel; }
 
 inline unsigned short CConfig::GetKind_ConductivityModel(void) { return Kind_ConductivityModel; }
@@ -571,6 +625,22 @@ inline unsigned short CConfig::GetKind_Linear_Solver(void) { return Kind_Linear_
 
 inline unsigned short CConfig::GetDeform_Linear_Solver(void) { return Deform_Linear_Solver; }
 
+inline unsigned short CConfig::GetDeform_Linear_Solver_Prec(void) { return Deform_Linear_Solver_Prec; }
+
+inline bool CConfig::GetDeform_Warm_Start(void) { return Deform_Warm_Start; }
+
+inline bool CConfig::GetDeform_Frozen_Stiffness(void) { return Deform_Frozen_Stiffness; }
+
+inline unsigned short CConfig::GetDeform_Kind(void) { return Deform_Kind; }
+
+inline unsigned short CConfig::GetDeform_RBF_Function(void) { return Deform_RBF_Function; }
+
+inline su2double CConfig::GetDeform_RBF_Radius(void) { return Deform_RBF_Radius; }
+
+inline su2double CConfig::GetDeform_RBF_Tolerance(void) { return Deform_RBF_Tolerance; }
+
+inline unsigned long CConfig::GetDeform_RBF_MaxPoints(void) { return Deform_RBF_MaxPoints; }
+
 inline unsigned short CConfig::GetKind_Linear_Solver_Prec(void) { return Kind_Linear_Solver_Prec; }
 
 inline void CConfig::SetKind_Linear_Solver_Prec(unsigned short val_kind_prec) { Kind_Linear_Solver_Prec = val_kind_prec; }
@@ -879,6 +949,10 @@ inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFo
 
 inline string CConfig::GetConv_FileName(void) { return Conv_FileName; }
 
+inline string CConfig::GetRuntime_FileName(void) { return Runtime_FileName; }
+
+inline unsigned short CConfig::GetRuntime_Command(void) { return Runtime_Command; }
+
 inline string CConfig::GetConv_FileName_FSI(void) { return Conv_FileName_FSI; }
 
 inline string CConfig::GetBreakdown_FileName(void) { return Breakdown_FileName; }
@@ -1041,6 +1115,8 @@ inline string CConfig::GetMotion_FileName(void) { return Motion_Filename; }
 
 inline bool CConfig::GetLow_MemoryOutput(void) { return Low_MemoryOutput; }
 
+inline bool CConfig::GetOutput_Compression(void) { return Output_Compression; }
+
 inline bool CConfig::GetWrt_Vol_Sol(void) { return Wrt_Vol_Sol; }
 
 inline bool CConfig::GetWrt_Srf_Sol(void) { return Wrt_Srf_Sol; }
@@ -1119,6 +1195,8 @@ inline unsigned short CConfig::GetnFFD_Iter(void) {return nFFD_Iter; }
 
 inline su2double CConfig::GetFFD_Tol(void) {return FFD_Tol; }
 
+inline bool CConfig::GetFFD_ParamCache(void) {return FFD_ParamCache; }
+
 inline long CConfig::GetVisualize_CV(void) {return Visualize_CV; }
 
 inline bool CConfig::GetFixed_CL_Mode(void) { return Fixed_CL_Mode; }
@@ -1151,6 +1229,10 @@ inline su2double CConfig::GetAitkenDynMaxInit(void) { return AitkenDynMaxInit; }
 
 inline su2double CConfig::GetAitkenDynMinInit(void) { return AitkenDynMinInit; }
 
+inline unsigned short CConfig::GetIQN_WindowSize(void) { return IQN_WindowSize; }
+
+inline unsigned short CConfig::GetIQN_ReuseTimeSteps(void) { return IQN_ReuseTimeSteps; }
+
 inline bool CConfig::GetDeadLoad(void) { return DeadLoad; }
 
 inline bool CConfig::GetMatchingMesh(void) { return MatchingMesh; }
@@ -1199,6 +1281,12 @@ inline bool CConfig::GetFSI_Simulation(void) { return FSI_Problem; }
 
 inline unsigned short CConfig::GetKindInterpolation(void) { return Kind_Interpolation; }
 
+inline bool CConfig::GetConservativeInterpolation(void) { return ConservativeInterpolation; }
+
+inline unsigned short CConfig::GetInterpolation_RBF_Function(void) { return Interpolation_RBF_Function; }
+
+inline unsigned short CConfig::GetInterpolation_RBF_Points(void) { return Interpolation_RBF_Points; }
+
 inline unsigned short CConfig::GetRelaxation_Method_FSI(void) { return Kind_BGS_RelaxMethod; }
 
 inline su2double CConfig::GetOrderMagResidualFSI(void) { return OrderMagResidualFSI; }
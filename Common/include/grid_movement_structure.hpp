@@ -122,6 +122,10 @@ public:
   vector<unsigned short> Fix_IPlane;  /*!< \brief Fix FFD I plane. */
   vector<unsigned short> Fix_JPlane;  /*!< \brief Fix FFD J plane. */
   vector<unsigned short> Fix_KPlane;  /*!< \brief Fix FFD K plane. */
+  vector<unsigned long> Basis_Begin,  /*!< \brief First weight of each surface point in the basis operator (CSR storage). */
+  Basis_ControlPoint;                 /*!< \brief Control point ((i*mOrder+j)*nOrder+k) of each weight of the basis operator. */
+  vector<su2double> Basis_Weight;     /*!< \brief Bernstein weights of the basis operator (control points to surface points). */
+  bool Basis_Set;                     /*!< \brief The basis operator is computed with the current parametric coordinates. */
 
 public:
 	
@@ -488,6 +492,16 @@ public:
 	 * \return Parametric coordinates of the point.
 	 */
 	su2double *GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, su2double *guess, CConfig *config);
+
+	/*!
+	 * \brief Newton method for the parametric coordinates when the box is reduced to its corner points
+	 *        (trilinear map), using the analytic Jacobian of the map.
+	 * \param[in] xyz - Cartesians coordinates of the target point.
+	 * \param[in] guess - Initial guess for doing the parametric coordinates search.
+	 * \param[in] config - Definition of the particular problem.
+	 * \return Parametric coordinates of the point, <code>NULL</code> if the method does not converge.
+	 */
+	su2double *GetParametricCoord_Newton(su2double *xyz, su2double *guess, CConfig *config);
 	
 	/*! 
 	 * \brief Compute the cross product.
@@ -512,6 +526,30 @@ public:
 	 * \return Pointer to the cartesian coordinates of a point.
 	 */		
 	su2double *EvalCartesianCoord(su2double *ParamCoord);
+
+	/*!
+	 * \brief Compute the basis operator from the control points to the surface points of the box,
+	 *        a sparse matrix with the Bernstein weights of each surface point (evaluated once at its
+	 *        parametric coordinates).
+	 */
+	void SetBasis(void);
+
+	/*!
+	 * \overload
+	 * \brief Cartesian coordinates of a surface point of the box, product of its row of the basis
+	 *        operator and the control points.
+	 * \param[in] val_iSurfacePoints - Index of the surface point.
+	 * \return Pointer to the cartesian coordinates of the point.
+	 */
+	su2double *EvalCartesianCoord(unsigned long val_iSurfacePoints);
+
+	/*!
+	 * \brief Transposed product of the basis operator, projection of a field on the surface points
+	 *        onto the control points (e.g. the sensitivities).
+	 * \param[in] val_surface - Field on the surface points (3 values per point).
+	 * \param[out] val_control - Field on the control points (3 values per point, ordered as (i*mOrder+j)*nOrder+k).
+	 */
+	void GetBasis_TransposedProduct(su2double *val_surface, su2double *val_control);
 	
 	/*! 
 	 * \brief Set the Bernstein polynomial, defined as B_i^n(t) = Binomial(n, i)*t^i*(1-t)^(n-i).
@@ -574,6 +612,18 @@ public:
 	 * \param[in] iFFDBox - Index of the FFDBox.
 	 */		
 	bool GetPointFFD(CGeometry *geometry, CConfig *config, unsigned long iPoint);
+
+	/*!
+	 * \brief Compute the axis aligned bounding box of the corner points.
+	 */
+	void SetBoundingBox(void);
+	
+	/*!
+	 * \brief Check if a point is inside the bounding box of the corner points (cheap test before <i>GetPointFFD</i>).
+	 * \param[in] xyz - Cartesians coordinates of the point.
+	 * \return <code>TRUE</code> if the point is inside the bounding box.
+	 */
+	bool GetPointBoundingBox(su2double *xyz);
 	
 	/*! 
 	 * \brief Set the zone of the computational domain that is going to be deformed.
@@ -755,6 +805,10 @@ protected:
   CSysVector LinSysSol;
   CSysVector LinSysRes;
 
+  bool StiffMatrix_Frozen;  /*!< \brief The stiffness matrix of the reference mesh is assembled (DEFORM_FROZEN_STIFFNESS). */
+  bool Precond_Frozen;      /*!< \brief The preconditioner of the frozen stiffness matrix is built. */
+  su2double MinVolume_Ref;  /*!< \brief Minimum volume of the mesh used to assemble the stiffness matrix. */
+
 public:
 
 	/*! 
@@ -1022,6 +1076,24 @@ public:
 	 */
   void SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative = false);
 
+  /*!
+	 * \brief Grid deformation by interpolation of the boundary displacements with compactly supported
+   *        radial basis functions, on a reduced set of control points (greedy selection).
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] UpdateGeo - Update geometry.
+	 */
+  void SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo);
+
+  /*!
+	 * \brief Value of a compactly supported radial basis function (Wendland).
+	 * \param[in] val_kind - Type of radial basis function (see ENUM_RADIALBASIS).
+	 * \param[in] val_dist - Distance to the control point.
+	 * \param[in] val_radius - Support radius.
+	 * \return Value of the radial basis function.
+	 */
+  su2double GetRadialBasis(unsigned short val_kind, su2double val_dist, su2double val_radius);
+
   /*!
    * \brief Set the derivatives of the boundary nodes.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1075,6 +1147,7 @@ public:
 class CSurfaceMovement : public CGridMovement {
 protected:
   CFreeFormDefBox** FFDBox;	/*!< \brief Definition of the Free Form Deformation Box. */
+  bool FFDSurfaceUpdate;  /*!< \brief Update the surface points of the FFD boxes without nesting (not needed to project the sensitivities). */
 	unsigned short nFFDBox;	/*!< \brief Number of FFD FFDBoxes. */
 	unsigned short nLevel;	/*!< \brief Level of the FFD FFDBoxes (parent/child). */
 	bool FFDBoxDefinition;	/*!< \brief If the FFD FFDBox has been defined in the input file. */
@@ -1261,6 +1334,32 @@ public:
 	 * \param[in] FFDBox - Array with all the free forms FFDBoxes of the computation.
 	 */		
 	void SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox);
+
+	/*!
+	 * \brief Name of the file with the parametric coordinates of a FFD box (next to the mesh file).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] FFDBox - FFD box.
+	 * \return Name of the file.
+	 */
+	string GetParametricCoord_FileName(CConfig *config, CFreeFormDefBox *FFDBox);
+	
+	/*!
+	 * \brief Read the parametric coordinates of a FFD box from the cache file, the file is only used if the box
+	 *        corner points and the coordinates of all the surface points match the current ones.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] FFDBox - FFD box.
+	 * \return <code>TRUE</code> if the parametric coordinates have been read.
+	 */
+	bool ReadParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox);
+	
+	/*!
+	 * \brief Write the parametric coordinates of a FFD box to the cache file.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] FFDBox - FFD box.
+	 */
+	void WriteParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox);
 	
 	/*! 
 	 * \brief Update the parametric coordinates of a grid point using a point inversion strategy
@@ -1466,6 +1565,20 @@ public:
 	 * \return Number of FFD FFDBoxes.
 	 */		
 	unsigned short GetnFFDBox(void);
+
+	/*!
+	 * \brief Obtain a FFD box.
+	 * \param[in] val_iFFDBox - Index of the FFD box.
+	 * \return Pointer to the FFD box.
+	 */
+	CFreeFormDefBox *GetFFDBox(unsigned short val_iFFDBox);
+
+	/*!
+	 * \brief Set if the surface points of the FFD boxes without nesting are updated after moving the control
+	 *        points. Only the control points are needed to project the sensitivities with the basis operator.
+	 * \param[in] val_update - <code>TRUE</code> (default) to update the surface points.
+	 */
+	void SetFFDSurfaceUpdate(bool val_update);
 	
 	/*! 
 	 * \brief Obtain the number of levels.
@@ -37,6 +37,10 @@ inline unsigned short CSurfaceMovement::GetnLevel(void) { return nLevel; }
 
 inline unsigned short CSurfaceMovement::GetnFFDBox(void) { return nFFDBox; }
 
+inline CFreeFormDefBox *CSurfaceMovement::GetFFDBox(unsigned short val_iFFDBox) { return FFDBox[val_iFFDBox]; }
+
+inline void CSurfaceMovement::SetFFDSurfaceUpdate(bool val_update) { FFDSurfaceUpdate = val_update; }
+
 inline bool CSurfaceMovement::GetFFDBoxDefinition(void) { return FFDBoxDefinition; }
 
 inline void CFreeFormDefBox::Set_Fix_IPlane(unsigned short val_plane) { Fix_IPlane.push_back(val_plane); }
@@ -77,11 +81,13 @@ inline void CFreeFormDefBox::Set_CartesianCoord(su2double *val_coord, unsigned l
 
 inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
 																																		 ParametricCoord[1].push_back(val_coord[1]); 
-																																		 ParametricCoord[2].push_back(val_coord[2]); }
+																																		 ParametricCoord[2].push_back(val_coord[2]);
+																																		 Basis_Set = false; }
 																																		 
 inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord, unsigned long val_iSurfacePoints) { ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
 																																																			 ParametricCoord[1][val_iSurfacePoints] = val_coord[1]; 
-																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2]; }
+																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2];
+																																																			 Basis_Set = false; }
 
 inline unsigned short CFreeFormDefBox::Get_MarkerIndex(unsigned long val_iSurfacePoints) { return MarkerIndex[val_iSurfacePoints]; }
 
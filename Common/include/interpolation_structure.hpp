@@ -37,6 +37,9 @@
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <vector>
+#include <map>
+#include <algorithm>
 
 #include "config_structure.hpp"
 #include "geometry_structure.hpp"
@@ -45,6 +48,93 @@
 using namespace std;
 
 
+/*!
+ * \class CKDTree
+ * \brief Balanced k-d tree of a point cloud, used for the nearest point and
+ *        radius searches of the interpolators.
+ * \author H. Kline
+ * \version 4.2.0 "Cardinal"
+ */
+class CKDTree {
+protected:
+  unsigned short nDim;            /*!\brief Number of dimensions of the points. */
+  unsigned long nPoint;           /*!\brief Number of points in the tree. */
+  vector<su2double> Coord;        /*!\brief Coordinates of the points, nPoint x nDim. */
+  vector<unsigned long> Index;    /*!\brief Points in tree order, the median of each range is the node. */
+  vector<unsigned short> SplitDim;/*!\brief Splitting direction of each node. */
+
+  /*!
+   * \brief Build the subtree of the points in the range [val_begin, val_end) of Index.
+   */
+  void Build(unsigned long val_begin, unsigned long val_end);
+
+  /*!
+   * \brief Nearest point search in the subtree of the range [val_begin, val_end) of Index.
+   */
+  void SearchNearest(unsigned long val_begin, unsigned long val_end, su2double *val_coord,
+                     unsigned long &val_point, su2double &val_dist) const;
+
+  /*!
+   * \brief Radius search in the subtree of the range [val_begin, val_end) of Index.
+   */
+  void SearchRadius(unsigned long val_begin, unsigned long val_end, su2double *val_coord,
+                    su2double val_radius2, vector<unsigned long> &val_points) const;
+
+  /*!
+   * \brief k nearest points search in the subtree of the range [val_begin, val_end) of Index,
+   *        val_heap is a max-heap of (squared distance, point) with at most val_k entries.
+   */
+  void SearchKNearest(unsigned long val_begin, unsigned long val_end, su2double *val_coord, unsigned long val_k,
+                      vector<pair<su2double, unsigned long> > &val_heap) const;
+
+public:
+
+  /*!
+   * \brief Constructor of the class, builds the tree.
+   * \param[in] val_nPoint - Number of points.
+   * \param[in] val_nDim - Number of dimensions.
+   * \param[in] val_coord - Coordinates of the points, stored point by point.
+   */
+  CKDTree(unsigned long val_nPoint, unsigned short val_nDim, su2double *val_coord);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CKDTree(void);
+
+  /*!
+   * \brief Find the point closest to a given coordinate, ties go to the lowest point index.
+   * \param[in] val_coord - Coordinates of the query.
+   * \param[out] val_dist - Squared distance to the closest point.
+   * \return Index of the closest point (the tree must not be empty).
+   */
+  unsigned long FindNearest(su2double *val_coord, su2double &val_dist) const;
+
+  /*!
+   * \brief Find all the points within a given distance of a coordinate.
+   * \param[in] val_coord - Coordinates of the query.
+   * \param[in] val_radius - Search radius.
+   * \param[out] val_points - Indices of the points inside the ball, in no particular order.
+   */
+  void FindRadius(su2double *val_coord, su2double val_radius, vector<unsigned long> &val_points) const;
+
+  /*!
+   * \brief Find the val_k points closest to a given coordinate (all of them if there are fewer).
+   * \param[in] val_coord - Coordinates of the query.
+   * \param[in] val_k - Number of points.
+   * \param[out] val_points - Indices of the points, sorted by distance (ties go to the lowest index).
+   * \param[out] val_dist - Squared distances to the points.
+   */
+  void FindNearest(su2double *val_coord, unsigned long val_k, vector<unsigned long> &val_points,
+                   vector<su2double> &val_dist) const;
+
+  /*!
+   * \brief Get the number of points of the tree.
+   */
+  unsigned long GetnPoint(void) const;
+
+};
+
 /*!
  * \class CInterpolator
  * \brief Main class for defining the interpolator, it requires
@@ -82,6 +172,22 @@ protected:
   *Buffer_Receive_Coord,/*!\brief Buffer to receive coordinate values*/
   *Buffer_Receive_Normal;/*!\brief Buffer to receive normal vector values*/
 
+  su2double *Target_BBox,/*!\brief Bounding box (min, max) of the local target vertices of the interface*/
+  *Donor_BBox;/*!\brief Bounding box (min, max) of all the donor elements of the interface*/
+
+  vector<unsigned long> Local_ElemIndex,/*!\brief Index of the first node of each local donor element*/
+  Local_GlobalPoint;/*!\brief Global index of the nodes of the local donor elements*/
+  vector<int> Local_Processor;/*!\brief Owner of the nodes of the local donor elements*/
+  vector<su2double> Local_Coord,/*!\brief Coordinates of the nodes of the local donor elements*/
+  Local_Normal,/*!\brief Normal vector of the local donor elements*/
+  Local_BBox;/*!\brief Bounding box of the local donor elements*/
+
+  vector<unsigned long> Donor_ElemIndex,/*!\brief Index of the first node of each received donor element*/
+  Donor_GlobalPoint;/*!\brief Global index of the nodes of the received donor elements*/
+  vector<int> Donor_Processor;/*!\brief Owner of the nodes of the received donor elements*/
+  vector<su2double> Donor_Coord,/*!\brief Coordinates of the nodes of the received donor elements*/
+  Donor_Normal;/*!\brief Normal vector of the received donor elements*/
+
 
 
 public:
@@ -136,6 +242,57 @@ public:
    */
   void Collect_VertexInfo(bool faces, int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim);
 
+  /*!
+   * \brief Compute the bounding box of the local target vertices (Target_BBox), empty if there are none.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDim - number of physical dimensions.
+   */
+  void Set_TargetBoundingBox(int markTarget, unsigned short nDim);
+
+  /*!
+   * \brief Store the local donor elements of the interface: the vertices, or if faces=true the faces
+   * (edges in 2D) of the marker. Each face is stored once, by the owner of its first node, together
+   * with the normal vector at that node. Also computes the global donor bounding box (Donor_BBox).
+   * \param[in] faces - boolean that determines whether the elements are faces or vertices
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] nDim - number of physical dimensions.
+   */
+  void Collect_DonorElements(bool faces, int markDonor, unsigned short nDim);
+
+  /*!
+   * \brief Append an element to the local donor elements.
+   * \param[in] nNodes - Number of nodes of the element.
+   * \param[in] Nodes - Local indices of the nodes of the element.
+   * \param[in] Normal - Normal vector of the element, NULL for vertices.
+   * \param[in] nDim - number of physical dimensions.
+   */
+  void Store_DonorElement(unsigned short nNodes, unsigned long *Nodes, su2double *Normal, unsigned short nDim);
+
+  /*!
+   * \brief Send each local donor element to the processors whose padded target bounding box
+   * it overlaps, and store the received elements (Donor_*) ordered by sending processor.
+   * \param[in] faces - boolean that determines whether the normal vectors are sent as well
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] padding - Enlargement of the local target bounding box in each direction.
+   */
+  void Exchange_DonorElements(bool faces, unsigned short nDim, su2double padding);
+
+  /*!
+   * \brief Check whether the ball of radius dist around a target point lies inside the padded target box,
+   * in which case no donor beyond the padding can be closer than dist.
+   * \param[in] coord - Coordinates of the target point.
+   * \param[in] dist - Radius of the ball.
+   * \param[in] padding - Enlargement of the target bounding box.
+   * \param[in] nDim - number of physical dimensions.
+   */
+  bool Check_BoundingBox(su2double *coord, su2double dist, su2double padding, unsigned short nDim);
+
+  /*!
+   * \brief Get the padding for which the target bounding box covers all the donor elements.
+   * \param[in] nDim - number of physical dimensions.
+   */
+  su2double Get_CoverPadding(unsigned short nDim);
+
 
 };
 
@@ -214,6 +371,130 @@ public:
    */
   void Isoparameters(unsigned short nDim, unsigned short nDonor, su2double *X, su2double *xj,su2double* isoparams);
 
+  /*!
+   * \brief Project a target point on a received donor face and compute its isoparametric coefficients.
+   * \param[in] iElem - Index of the received donor face.
+   * \param[in] nDim - the dimension of the coordinates.
+   * \param[in] Coord_i - coordinates of the target point.
+   * \param[out] myCoeff - isoparametric coefficients of the nodes of the face.
+   * \return Squared distance between the target point and its interpolation on the face.
+   */
+  su2double Face_Distance(unsigned long iElem, unsigned short nDim, su2double *Coord_i, su2double *myCoeff);
+
+};
+
+/*!
+ * \brief Radial basis function interpolation: each target point is interpolated from its nearest donor
+ * points with a compactly supported radial basis function augmented with a linear polynomial, so that
+ * the coefficients reproduce linear fields and add up to one.
+ */
+class CRadialBasisFunction : public CInterpolator {
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - index of the donor zone
+   * \param[in] jZone - index of the target zone
+   */
+  CRadialBasisFunction(CGeometry ***geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CRadialBasisFunction(void);
+
+  /*!
+   * \brief Set up transfer matrix defining relation between two meshes
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_TransferCoeff(CConfig **config);
+
+  /*!
+   * \brief Value of a Wendland radial basis function.
+   * \param[in] val_kind - Type of function (WENDLAND_C0, WENDLAND_C2 or WENDLAND_C4).
+   * \param[in] val_dist - Distance to the center.
+   * \param[in] val_radius - Support radius.
+   */
+  su2double Get_RadialBasisValue(unsigned short val_kind, su2double val_dist, su2double val_radius);
+
+  /*!
+   * \brief Compute the interpolation coefficients of a target point from a set of donor points.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] nDonor - number of donor points.
+   * \param[in] Kind_RBF - Type of radial basis function.
+   * \param[in] X - Coordinates of the donor points, stored point by point.
+   * \param[in] Coord_i - Coordinates of the target point.
+   * \param[out] myCoeff - Interpolation coefficients (size nDonor).
+   * \return False if the interpolation matrix is not positive definite.
+   */
+  bool Get_LocalCoeff(unsigned short nDim, unsigned short nDonor, unsigned short Kind_RBF,
+                      su2double *X, su2double *Coord_i, su2double *myCoeff);
+
+};
+
+/*!
+ * \brief Mortar interpolation: the target faces are intersected with the donor faces projected on
+ * their plane and the product of the shape functions is integrated over the intersections. The rows
+ * are scaled by the integral of the target shape functions (lumped mass), so that the coefficients
+ * add up to one. Target points outside the donor surface use their nearest donor point.
+ */
+class CMortar : public CInterpolator {
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - index of the donor zone
+   * \param[in] jZone - index of the target zone
+   */
+  CMortar(CGeometry ***geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CMortar(void);
+
+  /*!
+   * \brief Set up transfer matrix defining relation between two meshes
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_TransferCoeff(CConfig **config);
+
+  /*!
+   * \brief Collect the boundary elements of the target marker that have at least one local node.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[out] FaceIndex - Index of the first node of each face.
+   * \param[out] FaceNodes - Local indices of the nodes of the faces.
+   * \param[out] FaceVertex - Vertex of the first node of each face (orientation of the normal).
+   */
+  void Collect_TargetFaces(int markTarget, unsigned short nDim, vector<unsigned long> &FaceIndex,
+                           vector<unsigned long> &FaceNodes, vector<unsigned long> &FaceVertex);
+
+  /*!
+   * \brief Evaluate the linear (bilinear for quadrilaterals) shape functions of a face at a point.
+   * \param[in] nNodes - number of nodes of the face (2, 3 or 4).
+   * \param[in] U - Coordinates of the nodes in the plane of the intersection (2 per node, the second one is not used if nNodes=2).
+   * \param[in] u - Coordinates of the point.
+   * \param[out] N - Values of the shape functions.
+   */
+  void Get_ShapeFunctions(unsigned short nNodes, su2double *U, su2double *u, su2double *N);
+
+  /*!
+   * \brief Intersect a polygon with a convex polygon (Sutherland-Hodgman), both counterclockwise.
+   * \param[in] nSubject - number of vertices of the polygon.
+   * \param[in] Subject - Coordinates of the vertices of the polygon.
+   * \param[in] nClip - number of vertices of the convex polygon.
+   * \param[in] Clip - Coordinates of the vertices of the convex polygon.
+   * \param[out] Result - Coordinates of the vertices of the intersection (size at least 2*(nSubject+nClip), nSubject+nClip <= 16).
+   * \return Number of vertices of the intersection.
+   */
+  unsigned short Clip_Polygon(unsigned short nSubject, su2double *Subject, unsigned short nClip, su2double *Clip,
+                              su2double *Result);
+
 };
 
 /*!
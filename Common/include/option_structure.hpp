@@ -282,12 +282,16 @@ enum ENUM_INTERPOLATOR {
   NEAREST_NEIGHBOR = 0,   /*!< \brief Nearest Neigbhor interpolation */
   ISOPARAMETRIC = 1, /*!< \brief Isoparametric interpolation */
   CONSISTCONSERVE = 2,/*!< \brief Consistent & Conservative interpolation (S.A. Brown 1997). Utilizes Isoparametric interpolation. */
+  RADIAL_BASIS_FUNCTION = 3, /*!< \brief Localized radial basis function interpolation with linear polynomial. */
+  MORTAR = 4           /*!< \brief Mortar interpolation, integrated on the intersection of the interface faces. */
 };
 
 static const map<string, ENUM_INTERPOLATOR> Interpolator_Map = CCreateMap<string, ENUM_INTERPOLATOR>
 ("NEAREST_NEIGHBOR", NEAREST_NEIGHBOR)
 ("ISOPARAMETRIC", ISOPARAMETRIC)
-("CONSISTCONSERVE", CONSISTCONSERVE);
+("CONSISTCONSERVE", CONSISTCONSERVE)
+("RADIAL_BASIS_FUNCTION", RADIAL_BASIS_FUNCTION)
+("MORTAR", MORTAR);
 
 
 /*!
@@ -685,13 +689,15 @@ enum ENUM_TRANSFER_METHOD {
   BROADCAST_DATA = 1,	/*!< \brief Gather data on one processor and broadcast it into all of them, relating to global nodes. */
   SCATTER_DATA = 2,   	/*!< \brief Gather data on one processor and scatter it into the one that needs it. */
   ALLGATHER_DATA = 3,   /*!< \brief All processors gather data (this will be useful for operations over a group of data - averaging) */
-  LEGACY_METHOD = 4		/*!< \brief Original transfer method, maintained to check . */
+  LEGACY_METHOD = 4,		/*!< \brief Original transfer method, maintained to check . */
+  SPARSE_DATA = 5       /*!< \brief Precomputed sparse operator, each processor receives only the donor values it needs. */
 };
 static const map<string, ENUM_TRANSFER_METHOD> Transfer_Method_Map = CCreateMap<string, ENUM_TRANSFER_METHOD>
 ("BROADCAST_DATA", BROADCAST_DATA)
 ("SCATTER_DATA", SCATTER_DATA)
 ("ALLGATHER_DATA", ALLGATHER_DATA)
-("LEGACY_METHOD", LEGACY_METHOD);
+("LEGACY_METHOD", LEGACY_METHOD)
+("SPARSE_DATA", SPARSE_DATA);
 
 /*!
  * \brief types of schemes to compute the flow gradient
@@ -780,12 +786,14 @@ static const map<string, ENUM_2DFORM> ElasForm_2D = CCreateMap<string, ENUM_2DFO
 enum ENUM_AITKEN {
   NO_RELAXATION = 0,			/*!< \brief No relaxation in the strongly coupled approach. */
   FIXED_PARAMETER = 1,			/*!< \brief Relaxation with a fixed parameter. */
-  AITKEN_DYNAMIC = 2			/*!< \brief Relaxation using Aitken's dynamic parameter. */
+  AITKEN_DYNAMIC = 2,			/*!< \brief Relaxation using Aitken's dynamic parameter. */
+  IQN_ILS = 3			/*!< \brief Interface quasi-Newton with an inverse least-squares model of the Jacobian. */
 };
 static const map<string, ENUM_AITKEN> AitkenForm_Map = CCreateMap<string, ENUM_AITKEN>
 ("NONE", NO_RELAXATION)
 ("FIXED_PARAMETER", FIXED_PARAMETER)
-("AITKEN_DYNAMIC", AITKEN_DYNAMIC);
+("AITKEN_DYNAMIC", AITKEN_DYNAMIC)
+("IQN_ILS", IQN_ILS);
 
 
 
@@ -1033,7 +1041,9 @@ enum ENUM_OUTPUT {
   FIELDVIEW_BINARY = 4,  /*!< \brief FieldView binary format for the solution output. */
   CSV = 5,			         /*!< \brief Comma-separated values format for the solution output. */
   CGNS_SOL = 6,  	     	 /*!< \brief CGNS format for the solution output. */
-  PARAVIEW = 7  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW = 7,  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW_BINARY = 8,   /*!< \brief Paraview legacy binary format for the solution output. */
+  PARAVIEW_XML = 9       /*!< \brief Paraview XML (.vtu, appended raw data) format for the solution output. */
 };
 static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPUT>
 ("TECPLOT", TECPLOT)
@@ -1042,7 +1052,22 @@ static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPU
 ("FIELDVIEW_BINARY", FIELDVIEW_BINARY)
 ("CSV", CSV)
 ("CGNS", CGNS_SOL)
-("PARAVIEW", PARAVIEW);
+("PARAVIEW", PARAVIEW)
+("PARAVIEW_BINARY", PARAVIEW_BINARY)
+("PARAVIEW_XML", PARAVIEW_XML);
+
+/*!
+ * \brief compression of the records of the unsteady solution history
+ */
+enum ENUM_HISTORY_COMPRESSION {
+  HISTORY_NONE = 0,      /*!< \brief Raw binary values. */
+  HISTORY_LOSSLESS = 1,  /*!< \brief Byte shuffle and zlib compression. */
+  HISTORY_LOSSY = 2      /*!< \brief Rounding to a relative tolerance, byte shuffle and zlib compression. */
+};
+static const map<string, ENUM_HISTORY_COMPRESSION> History_Compression_Map = CCreateMap<string, ENUM_HISTORY_COMPRESSION>
+("NONE", HISTORY_NONE)
+("LOSSLESS", HISTORY_LOSSLESS)
+("LOSSY", HISTORY_LOSSY);
 
 /*!
  * \brief type of multigrid cycle
@@ -1057,6 +1082,19 @@ static const map<string, MG_CYCLE> MG_Cycle_Map = CCreateMap<string, MG_CYCLE>
 ("W_CYCLE", W_CYCLE)
 ("FULLMG_CYCLE", FULLMG_CYCLE);
 
+/*!
+ * \brief commands that can be issued through the runtime control file
+ */
+enum ENUM_RUNTIME_COMMAND {
+  RUNTIME_CMD_NONE = 0,   /*!< \brief No command, only the runtime parameters are updated. */
+  RUNTIME_CMD_STOP = 1,   /*!< \brief Write the solution files and stop the simulation. */
+  RUNTIME_CMD_WRITE = 2   /*!< \brief Write the solution files and continue the simulation. */
+};
+static const map<string, ENUM_RUNTIME_COMMAND> Runtime_Command_Map = CCreateMap<string, ENUM_RUNTIME_COMMAND>
+("NONE", RUNTIME_CMD_NONE)
+("STOP", RUNTIME_CMD_STOP)
+("WRITE_SOLUTION", RUNTIME_CMD_WRITE);
+
 /*!
  * \brief type of solution output variables
  */
@@ -1271,6 +1309,30 @@ static const map<string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map = CCreateMa
 ("INVERSE_VOLUME", INVERSE_VOLUME)
 ("WALL_DISTANCE", WALL_DISTANCE);
 
+/*!
+ * \brief Method of the volumetric grid deformation.
+ */
+enum ENUM_DEFORM_KIND {
+  DEFORM_ELASTICITY = 0,   /*!< \brief Linear elasticity equations (finite element method). */
+  DEFORM_RBF = 1           /*!< \brief Radial basis function interpolation of the boundary displacements. */
+};
+static const map<string, ENUM_DEFORM_KIND> Deform_Kind_Map = CCreateMap<string, ENUM_DEFORM_KIND>
+("ELASTICITY", DEFORM_ELASTICITY)
+("RBF", DEFORM_RBF);
+
+/*!
+ * \brief Types of radial basis functions (compact support).
+ */
+enum ENUM_RADIALBASIS {
+  WENDLAND_C0 = 0,   /*!< \brief Wendland function with C0 continuity. */
+  WENDLAND_C2 = 1,   /*!< \brief Wendland function with C2 continuity. */
+  WENDLAND_C4 = 2    /*!< \brief Wendland function with C4 continuity. */
+};
+static const map<string, ENUM_RADIALBASIS> Radial_Basis_Map = CCreateMap<string, ENUM_RADIALBASIS>
+("WENDLAND_C0", WENDLAND_C0)
+("WENDLAND_C2", WENDLAND_C2)
+("WENDLAND_C4", WENDLAND_C4);
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -101,14 +101,40 @@ CConfig::CConfig(char case_filename[MAX_STRING_SIZE], CConfig *config) {
   
   runtime_file = SetRunTime_Parsing(case_filename);
   
-  /*--- Update original config file ---*/
+  /*--- Update original config file, only with the parameters
+   that are present in the runtime file ---*/
   
   if (runtime_file) {
-    config->SetnExtIter(nExtIter);
+    if (nExtIter != 0) config->SetnExtIter(nExtIter);
+    if (CFLFineGrid > 0.0) config->SetCFL_FineGrid(CFLFineGrid);
+  }
+  
+  /*--- A missing or wrong runtime file does not change anything ---*/
+  
+  else {
+    nExtIter = 0;
+    CFLFineGrid = 0.0;
+    Runtime_Command = RUNTIME_CMD_NONE;
   }
 
 }
 
+void CConfig::SetCFL_FineGrid(su2double val_cfl) {
+  
+  unsigned short iCFL;
+  
+  CFLFineGrid = val_cfl;
+  
+  /*--- Same distribution over the multigrid levels as in SetPostprocessing ---*/
+  
+  if (CFL == NULL) return;
+  CFL[0] = CFLFineGrid;
+  if (ContinuousAdjoint) CFL[0] = CFL[0] * CFLRedCoeff_AdjFlow;
+  for (iCFL = 1; iCFL < nCFL; iCFL++)
+    CFL[iCFL] = CFL[iCFL-1];
+  
+}
+
 void CConfig::SetPointersNull(void) {
   Marker_CfgFile_Out_1D=NULL;       Marker_All_Out_1D=NULL;
   Marker_CfgFile_GeoEval=NULL;      Marker_All_GeoEval=NULL;
@@ -120,7 +146,7 @@ void CConfig::SetPointersNull(void) {
   Marker_CfgFile_PerBound=NULL;     Marker_All_PerBound=NULL;   Marker_PerBound=NULL;
   Marker_CfgFile_FSIinterface=NULL;
   
-  Marker_DV=NULL;  Marker_Moving=NULL;  Marker_Monitoring=NULL;
+  Marker_DV=NULL;  Marker_Moving=NULL;  Marker_Monitoring=NULL;  Marker_Sample=NULL;
   Marker_Designing=NULL;  Marker_GeoEval=NULL;  Marker_Plotting=NULL;
   Marker_CfgFile_KindBC=NULL;       Marker_All_KindBC=NULL;
   /*--- Marker Pointers ---*/
@@ -187,6 +213,7 @@ void CConfig::SetPointersNull(void) {
   Plunging_Omega_X = NULL;    Plunging_Omega_Y = NULL;    Plunging_Omega_Z = NULL;
   Plunging_Ampl_X = NULL;     Plunging_Ampl_Y = NULL;     Plunging_Ampl_Z = NULL;
   RefOriginMoment_X = NULL;   RefOriginMoment_Y = NULL;   RefOriginMoment_Z = NULL;
+  Sample_Probes = NULL;       Sample_Lines = NULL;        Sample_Planes = NULL;
   MoveMotion_Origin = NULL;
   Periodic_Translate=NULL;    Periodic_Rotation=NULL;    Periodic_Center=NULL;
   Periodic_Translation=NULL;   Periodic_RotAngles=NULL;   Periodic_RotCenter=NULL;
@@ -195,14 +222,23 @@ void CConfig::SetPointersNull(void) {
   
   ExtIter = 0;
   IntIter = 0;
+  Runtime_Command = RUNTIME_CMD_NONE;
   
 }
 
 void CConfig::SetRunTime_Options(void) {
   
-  /* DESCRIPTION: Number of external iterations */
+  /* DESCRIPTION: Number of external iterations (0 keeps the current value) */
   
-  addUnsignedLongOption("EXT_ITER", nExtIter, 999999);
+  addUnsignedLongOption("EXT_ITER", nExtIter, 0);
+  
+  /* DESCRIPTION: CFL number of the finest grid (0 keeps the current value) */
+  
+  addDoubleOption("CFL_NUMBER", CFLFineGrid, 0.0);
+  
+  /* DESCRIPTION: Command for the running simulation (NONE, STOP, WRITE_SOLUTION) */
+  
+  addEnumOption("RUNTIME_COMMAND", Runtime_Command, Runtime_Command_Map, RUNTIME_CMD_NONE);
 
 }
 
@@ -284,6 +320,20 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the look-up tables of the real gas models ---*/
+  /* DESCRIPTION: Interpolate the VW_GAS or PR_GAS model from look-up tables */
+  addBoolOption("LUT_FLUID_MODEL", FluidModel_LUT, false);
+  /* DESCRIPTION: File with the look-up tables (generated if missing or built for another model) */
+  addStringOption("LUT_FILENAME", LUT_FileName, string("fluid_model.lut"));
+  /* DESCRIPTION: Number of nodes per direction of the look-up tables */
+  addUnsignedLongOption("LUT_NPOINTS", LUT_nPoints, 200);
+  /* DESCRIPTION: Pressure range of the look-up tables (0.0 for 0.05 and 5 times the free-stream pressure) */
+  addDoubleOption("LUT_PRESSURE_MIN", LUT_Pressure_Min, 0.0);
+  addDoubleOption("LUT_PRESSURE_MAX", LUT_Pressure_Max, 0.0);
+  /* DESCRIPTION: Temperature range of the look-up tables (0.0 for 0.5 and 2 times the free-stream temperature) */
+  addDoubleOption("LUT_TEMPERATURE_MIN", LUT_Temperature_Min, 0.0);
+  addDoubleOption("LUT_TEMPERATURE_MAX", LUT_Temperature_Max, 0.0);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -822,6 +872,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
+  /*!\brief RUNTIME_FILENAME \n DESCRIPTION: Runtime control file, checked by the master node for modifications every iteration \n DEFAULT: runtime.dat \ingroup Config*/
+  addStringOption("RUNTIME_FILENAME", Runtime_FileName, string("runtime.dat"));
   /*!\brief BREAKDOWN_FILENAME \n DESCRIPTION: Output file forces breakdown \ingroup Config*/
   addStringOption("BREAKDOWN_FILENAME", Breakdown_FileName, string("forces_breakdown.dat"));
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
@@ -892,6 +944,48 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief WRT_SOL_FREQ_DUALTIME
    *  \n DESCRIPTION: Writing solution file frequency for dual time  \ingroup Config*/
   addUnsignedLongOption("WRT_SOL_FREQ_DUALTIME", Wrt_Sol_Freq_DualTime, 1);
+  /*!\brief WRT_SOL_WALLTIME
+   *  \n DESCRIPTION: Wall-clock time between checkpoints (restart files), in minutes (0 disables)  \ingroup Config*/
+  addDoubleOption("WRT_SOL_WALLTIME", Wrt_Sol_WallTime, 0.0);
+  /*!\brief CHECKPOINT_SIGNAL
+   *  \n DESCRIPTION: Write the solution and stop after the current iteration when SIGTERM or SIGUSR1 is received  \ingroup Config*/
+  addBoolOption("CHECKPOINT_SIGNAL", Checkpoint_Signal, false);
+  /*!\brief WRT_RESTART_BACKUP
+   *  \n DESCRIPTION: Write the restart files through a temporary file and keep the previous one as a backup (.bak)  \ingroup Config*/
+  addBoolOption("WRT_RESTART_BACKUP", Wrt_Restart_Backup, false);
+  /*!\brief UNSTEADY_HISTORY
+   *  \n DESCRIPTION: Store the unsteady flow restarts in a single container file instead of one file per time step  \ingroup Config*/
+  addBoolOption("UNSTEADY_HISTORY", Unsteady_History, false);
+  /*!\brief UNSTEADY_HISTORY_COMPRESSION
+   *  \n DESCRIPTION: Compression of the unsteady history (NONE, LOSSLESS, LOSSY)  \ingroup Config*/
+  addEnumOption("UNSTEADY_HISTORY_COMPRESSION", Kind_History_Compression, History_Compression_Map, HISTORY_LOSSLESS);
+  /*!\brief UNSTEADY_HISTORY_TOLERANCE
+   *  \n DESCRIPTION: Relative error bound of the LOSSY compression of the unsteady history  \ingroup Config*/
+  addDoubleOption("UNSTEADY_HISTORY_TOLERANCE", History_Tolerance, 1E-8);
+  /*!\brief UNSTEADY_HISTORY_STEPS
+   *  \n DESCRIPTION: Time steps per unsteady history file (0, a single file for the whole simulation)  \ingroup Config*/
+  addUnsignedLongOption("UNSTEADY_HISTORY_STEPS", History_Steps, 0);
+  /*!\brief SAMPLE_PROBES
+   *  \n DESCRIPTION: Coordinates of the sampling probes (x, y, z for each probe)  \ingroup Config*/
+  addDoubleListOption("SAMPLE_PROBES", nSample_Probes, Sample_Probes);
+  /*!\brief SAMPLE_LINES
+   *  \n DESCRIPTION: Sampling lines (start x, y, z, end x, y, z, number of points for each line)  \ingroup Config*/
+  addDoubleListOption("SAMPLE_LINES", nSample_Lines, Sample_Lines);
+  /*!\brief SAMPLE_PLANES
+   *  \n DESCRIPTION: Sampling planes (origin x, y, z, first edge x, y, z, second edge x, y, z, number of points along each edge)  \ingroup Config*/
+  addDoubleListOption("SAMPLE_PLANES", nSample_Planes, Sample_Planes);
+  /*!\brief MARKER_SAMPLE
+   *  \n DESCRIPTION: Markers where the flow is sampled at every point  \ingroup Config*/
+  addStringListOption("MARKER_SAMPLE", nMarker_Sample, Marker_Sample);
+  /*!\brief SAMPLE_FREQ
+   *  \n DESCRIPTION: Sampling frequency (iterations)  \ingroup Config*/
+  addUnsignedLongOption("SAMPLE_FREQ", Sample_Freq, 1);
+  /*!\brief SAMPLE_BUFFER
+   *  \n DESCRIPTION: Number of samples kept in memory before they are written  \ingroup Config*/
+  addUnsignedLongOption("SAMPLE_BUFFER", Sample_Buffer, 100);
+  /*!\brief SAMPLE_FILENAME
+   *  \n DESCRIPTION: Output file of the samples (binary)  \ingroup Config*/
+  addStringOption("SAMPLE_FILENAME", Sample_FileName, string("sample.bin"));
   /*!\brief WRT_CON_FREQ
    *  \n DESCRIPTION: Writing convergence history frequency  \ingroup Config*/
   addUnsignedLongOption("WRT_CON_FREQ",  Wrt_Con_Freq, 1);
@@ -901,6 +995,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief LOW_MEMORY_OUTPUT
    *  \n DESCRIPTION: Output less information for lower memory use.  \ingroup Config*/
   addBoolOption("LOW_MEMORY_OUTPUT", Low_MemoryOutput, false);
+  /*!\brief OUTPUT_COMPRESSION
+   *  \n DESCRIPTION: Compress the data blocks of binary output files with zlib (PARAVIEW_XML only).  \ingroup Config*/
+  addBoolOption("OUTPUT_COMPRESSION", Output_Compression, false);
   /*!\brief WRT_VOL_SOL
    *  \n DESCRIPTION: Write a volume solution file  \ingroup Config*/
   addBoolOption("WRT_VOL_SOL", Wrt_Vol_Sol, true);
@@ -1136,6 +1233,22 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("DEFORM_POISSONS_RATIO", Deform_PoissonRatio, 0.3);
   /*  DESCRIPTION: Linear solver for the mesh deformation\n OPTIONS: see \link Linear_Solver_Map \endlink \n DEFAULT: FGMRES \ingroup Config*/
   addEnumOption("DEFORM_LINEAR_SOLVER", Deform_Linear_Solver, Linear_Solver_Map, FGMRES);
+  /*  DESCRIPTION: Preconditioner of the linear solver for the mesh deformation (LU_SGS, ILU0, JACOBI) \ingroup Config*/
+  addEnumOption("DEFORM_LINEAR_SOLVER_PREC", Deform_Linear_Solver_Prec, Linear_Solver_Prec_Map, LU_SGS);
+  /* DESCRIPTION: Use the previous displacement field as the initial guess of the mesh deformation */
+  addBoolOption("DEFORM_WARM_START", Deform_Warm_Start, false);
+  /* DESCRIPTION: Assemble the stiffness matrix (and its preconditioner) of the mesh deformation only once, on the reference mesh */
+  addBoolOption("DEFORM_FROZEN_STIFFNESS", Deform_Frozen_Stiffness, false);
+  /*  DESCRIPTION: Method of the volumetric grid deformation (ELASTICITY, RBF) \ingroup Config*/
+  addEnumOption("DEFORM_KIND", Deform_Kind, Deform_Kind_Map, DEFORM_ELASTICITY);
+  /*  DESCRIPTION: Radial basis function of the RBF grid deformation (WENDLAND_C0, WENDLAND_C2, WENDLAND_C4) \ingroup Config*/
+  addEnumOption("DEFORM_RBF_FUNCTION", Deform_RBF_Function, Radial_Basis_Map, WENDLAND_C2);
+  /*  DESCRIPTION: Support radius of the radial basis functions (0.0, the size of the boundary) \ingroup Config*/
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /*  DESCRIPTION: Tolerance of the greedy selection of the RBF control points (relative to the maximum displacement) \ingroup Config*/
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tolerance, 1E-3);
+  /*  DESCRIPTION: Maximum number of RBF control points (0, no limit) \ingroup Config*/
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_MaxPoints, 1000);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -1261,6 +1374,12 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
    * Sets Kind_Interpolation \ingroup Config
    */
   addEnumOption("KIND_INTERPOLATION", Kind_Interpolation, Interpolator_Map, NEAREST_NEIGHBOR);
+  /* DESCRIPTION: Transfer the loads to the structure with the transpose of the displacement interpolation (exact load conservation) */
+  addBoolOption("CONSERVATIVE_INTERPOLATION", ConservativeInterpolation, false);
+  /* DESCRIPTION: Radial basis function of the RBF interpolation between zones (WENDLAND_C0, WENDLAND_C2, WENDLAND_C4) */
+  addEnumOption("INTERPOLATION_RBF_FUNCTION", Interpolation_RBF_Function, Radial_Basis_Map, WENDLAND_C2);
+  /* DESCRIPTION: Number of donor points of the RBF interpolation of each target point (0: 4 in 2D, 12 in 3D) */
+  addUnsignedShortOption("INTERPOLATION_RBF_POINTS", Interpolation_RBF_Points, 0);
 
   /* DESCRIPTION: Maximum number of FSI iterations */
   addUnsignedShortOption("FSI_ITER", nIterFSI, 1);
@@ -1270,6 +1389,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("AITKEN_DYN_MAX_INITIAL", AitkenDynMaxInit, 0.5);
   /* DESCRIPTION: Aitken's dynamic minimum relaxation factor for the first iteration */
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
+  /* DESCRIPTION: Maximum number of secant pairs of the interface quasi-Newton method (BGS_RELAXATION= IQN_ILS) */
+  addUnsignedShortOption("IQN_WINDOW_SIZE", IQN_WindowSize, 20);
+  /* DESCRIPTION: Number of previous time steps whose secant pairs are reused by the interface quasi-Newton method */
+  addUnsignedShortOption("IQN_REUSE_TIMESTEPS", IQN_ReuseTimeSteps, 2);
   /* DESCRIPTION: Type of gust */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, NO_RELAXATION);
 
@@ -1316,6 +1439,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Free surface damping coefficient */
 	addDoubleOption("FFD_TOLERANCE", FFD_Tol, 1E-10);
 
+  /* DESCRIPTION: Cache the parametric coordinates of the point inversion in a file next to the mesh */
+  addBoolOption("FFD_PARAMETRIC_CACHE", FFD_ParamCache, false);
+
   /* DESCRIPTION: Definition of the FFD boxes */
   addFFDDefOption("FFD_DEFINITION", nFFDBox, CoordFFDBox, TagFFDBox);
   
@@ -1566,14 +1692,22 @@ bool CConfig::SetRunTime_Parsing(char case_filename[MAX_STRING_SIZE]) {
     }
   }
   
-  /*--- See if there were any errors parsing the runtime file ---*/
+  case_file.close();
+  
+  /*--- See if there were any errors parsing the runtime file. The file is
+   edited while the simulation is running, so the errors are reported and the
+   whole file is ignored instead of stopping the computation ---*/
   
   if (errorString.size() != 0) {
-    if (rank == MASTER_NODE) cout << errorString << endl;
-    exit(EXIT_FAILURE);
+    if (rank == MASTER_NODE) cout << errorString << "The runtime file is ignored." << endl;
+    return false;
   }
   
-  case_file.close();
+  /*--- Set the default values for all of the options that weren't set ---*/
+  
+  for (map<string, bool>::iterator iter = all_options.begin(); iter != all_options.end(); ++iter) {
+    option_map[iter->first]->SetDefault();
+  }
   
   return true;
   
@@ -1596,7 +1730,32 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Output_FileFormat = TECPLOT;
   }
 #endif
-  
+
+#ifndef HAVE_ZLIB
+  if (Output_Compression) {
+    cout << "Compressed output requested but SU2 was built without zlib support." << "\n";
+    Output_Compression = false;
+  }
+  if (Unsteady_History && (Kind_History_Compression != HISTORY_NONE)) {
+    cout << "Compressed unsteady history requested but SU2 was built without zlib support." << "\n";
+    Kind_History_Compression = HISTORY_NONE;
+  }
+#endif
+
+  /*--- Check the definition of the sampling probes, lines and planes ---*/
+
+  if ((nSample_Probes % 3 != 0) || (nSample_Lines % 7 != 0) || (nSample_Planes % 11 != 0)) {
+    cout << "SAMPLE_PROBES needs 3 values per probe, SAMPLE_LINES 7 values per line and SAMPLE_PLANES 11 values per plane!!" << endl;
+    exit(EXIT_FAILURE);
+  }
+
+  /*--- The linelet preconditioner is not available for the grid deformation ---*/
+
+  if (Deform_Linear_Solver_Prec == LINELET) {
+    cout << "DEFORM_LINEAR_SOLVER_PREC must be LU_SGS, ILU0 or JACOBI!!" << endl;
+    exit(EXIT_FAILURE);
+  }
+
   /*--- Store the SU2 module that we are executing. ---*/
   
   Kind_SU2 = val_software;
@@ -3863,6 +4022,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview binary (.vtk)." << endl; break;
+      case PARAVIEW_XML: cout << "The output file format is Paraview XML (.vtu)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -3900,6 +4061,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     if (Low_MemoryOutput) cout << "Writing output files with low memory RAM requirements."<< endl;
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview binary (.vtk)." << endl; break;
+      case PARAVIEW_XML: cout << "The output file format is Paraview XML (.vtu)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -4567,6 +4730,10 @@ CConfig::~CConfig(void) {
   if (Marker_DV!=NULL)               delete[] Marker_DV;
   if (Marker_Moving != NULL)           delete[] Marker_Moving;
   if (Marker_Monitoring != NULL)      delete[] Marker_Monitoring;
+  if (Marker_Sample != NULL)          delete[] Marker_Sample;
+  if (Sample_Probes != NULL)          delete[] Sample_Probes;
+  if (Sample_Lines != NULL)           delete[] Sample_Lines;
+  if (Sample_Planes != NULL)          delete[] Sample_Planes;
   if (Marker_Designing != NULL)       delete[] Marker_Designing;
   if (Marker_GeoEval != NULL)         delete[] Marker_GeoEval;
   if (Marker_Plotting != NULL)        delete[] Marker_Plotting;
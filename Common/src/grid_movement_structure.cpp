@@ -31,6 +31,7 @@
 
 #include "../include/grid_movement_structure.hpp"
 #include <list>
+#include <algorithm>
 
 using namespace std;
 
@@ -50,12 +51,20 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
 
 	  nIterMesh = 0;
 
-	  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
+	  StiffMatrix_Frozen = false;
+	  Precond_Frozen = false;
+	  MinVolume_Ref = 0.0;
 
-	  config->SetKind_Linear_Solver_Prec(LU_SGS);
+	  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver.
+	   The matrix storage depends on the preconditioner of the grid deformation,
+	   the preconditioner of the flow solvers is restored afterwards. ---*/
+
+	  unsigned short Kind_Linear_Solver_Prec = config->GetKind_Linear_Solver_Prec();
+	  config->SetKind_Linear_Solver_Prec(config->GetDeform_Linear_Solver_Prec());
 	  LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
 	  LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 	  StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+	  config->SetKind_Linear_Solver_Prec(Kind_Linear_Solver_Prec);
   
 }
 
@@ -123,7 +132,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   unsigned long IterLinSol = 0, Smoothing_Iter, iNonlinear_Iter, MaxIter = 0, RestartIter = 50, Tot_Iter = 0, Nonlinear_Iter = 0;
   su2double MinVolume, MaxVolume, NumError, Tol_Factor, Residual = 0.0, Residual_Init = 0.0;
-  bool Screen_Output;
+  bool Screen_Output, Warm_Start, Frozen_Stiffness, Moving_Boundary;
   
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
@@ -137,6 +146,21 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   Tol_Factor     = config->GetDeform_Tol_Factor();
   Nonlinear_Iter = config->GetGridDef_Nonlinear_Iter();
   
+  /*--- The previous displacement field (last time step or nonlinear increment)
+   is the initial guess, and the stiffness matrix of the reference mesh can be
+   reused, but not for the derivatives (different boundary conditions). ---*/
+  
+  Warm_Start       = config->GetDeform_Warm_Start() && !Derivative;
+  Frozen_Stiffness = config->GetDeform_Frozen_Stiffness() && !Derivative;
+  
+  /*--- Radial basis function deformation (no linear system). The derivatives
+   are computed with the linear elasticity equations. ---*/
+  
+  if ((config->GetDeform_Kind() == DEFORM_RBF) && !Derivative) {
+    SetVolume_Deformation_RBF(geometry, config, UpdateGeo);
+    return;
+  }
+  
   /*--- Disable the screen output if we're running SU2_CFD ---*/
   
   if (config->GetKind_SU2() == SU2_CFD && !Derivative) Screen_Output = false;
@@ -153,15 +177,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
     /*--- Initialize vector and sparse matrix ---*/
     
-    LinSysSol.SetValZero();
+    if (!Warm_Start) LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
     
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+     elasticity equations (transfers element stiffnesses to point-to-point).
+     With a frozen stiffness, the matrix of the reference mesh is kept (the
+     Dirichlet rows set below are the same at every deformation). ---*/
     
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    if (!Frozen_Stiffness || !StiffMatrix_Frozen) {
+      StiffMatrix.SetValZero();
+      MinVolume_Ref = SetFEAMethodContributions_Elem(geometry, config);
+      StiffMatrix_Frozen = Frozen_Stiffness;
+      Precond_Frozen = false;
+    }
+    MinVolume = MinVolume_Ref;
     
     /*--- Compute the tolerance of the linear solver using MinLength ---*/
     
@@ -193,6 +224,15 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     StiffMatrix.SendReceive_Solution(LinSysSol, geometry, config);
     StiffMatrix.SendReceive_Solution(LinSysRes, geometry, config);
 
+    /*--- The solution of a static boundary is zero, do not start from the
+     previous displacement (no iterations, the mesh is not moved) ---*/
+
+    Moving_Boundary = true;
+    if (Warm_Start && (LinSysRes.norm() == 0.0)) {
+      LinSysSol.SetValZero();
+      Moving_Boundary = false;
+    }
+
     /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
 
     /*--- If we want no derivatives or the direct derivatives,
@@ -201,7 +241,23 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
      * hence we need the corresponding matrix vector product and the preconditioner.  ---*/
     if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)){
       mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
-      precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
+      
+      /*--- The ILU and Jacobi preconditioners of a frozen stiffness matrix are only built once ---*/
+      
+      switch (config->GetDeform_Linear_Solver_Prec()) {
+        case ILU:
+          if (!Precond_Frozen) StiffMatrix.BuildILUPreconditioner();
+          precond = new CILUPreconditioner(StiffMatrix, geometry, config);
+          break;
+        case JACOBI:
+          if (!Precond_Frozen) StiffMatrix.BuildJacobiPreconditioner();
+          precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
+          break;
+        default:
+          precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
+          break;
+      }
+      Precond_Frozen = StiffMatrix_Frozen;
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
       /*--- Build the ILU preconditioner for the transposed system ---*/
@@ -292,8 +348,10 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
     ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume);
     
-    /*--- Set number of iterations in the mesh update. ---*/
+    /*--- Set number of iterations in the mesh update. A warm started
+     solver may need no iteration while the mesh is moving. ---*/
 
+    if (Warm_Start && Moving_Boundary) Tot_Iter = max(Tot_Iter, (unsigned long)1);
     Set_nIterMesh(Tot_Iter);
 
     if (rank == MASTER_NODE) {
@@ -307,6 +365,328 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
 }
 
+su2double CVolumetricMovement::GetRadialBasis(unsigned short val_kind, su2double val_dist, su2double val_radius) {
+
+  su2double r = val_dist/val_radius;
+
+  /*--- Wendland functions, compact support of radius val_radius and
+   normalized to one at the origin ---*/
+
+  if (r >= 1.0) return 0.0;
+
+  switch (val_kind) {
+    case WENDLAND_C0: return pow(1.0-r, 2.0);
+    case WENDLAND_C2: return pow(1.0-r, 4.0)*(4.0*r+1.0);
+    case WENDLAND_C4: return pow(1.0-r, 6.0)*(35.0*r*r+18.0*r+3.0)/3.0;
+  }
+
+  return 0.0;
+
+}
+
+void CVolumetricMovement::SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo) {
+
+  unsigned short iDim, iMarker, axis = 0, Priority, Kind_RBF = config->GetDeform_RBF_Function();
+  unsigned long iPoint, iVertex, iControl, jControl, iSelected, jSelected, nControl, nLocal, nMaxLocal,
+  nSelected, nAdd, MaxPoints = config->GetDeform_RBF_MaxPoints(), total_index;
+  su2double *VarCoord, *Coord, MeanCoord[3], Dist, Value, MaxDisp = 0.0, MaxError = 0.0, Error,
+  Radius = config->GetDeform_RBF_Radius(), Tol = config->GetDeform_RBF_Tolerance(), MinVolume, MaxVolume,
+  Box_Min[3], Box_Max[3];
+  unsigned short Kind_SU2 = config->GetKind_SU2();
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- Prescribed displacement of the boundary points: zero on the fixed
+   surfaces, the surface deformation on the moving (or design) surfaces and
+   on the FSI interfaces. The points of the symmetry planes (only) are free,
+   their normal displacement is removed afterwards. Same precedence as in
+   SetBoundaryDisplacements. ---*/
+
+  vector<unsigned short> Point_Priority(nPoint, 0);
+  vector<su2double> Point_Disp(nPoint*nDim, 0.0);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) ||
+        (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) ||
+        (config->GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY)) continue;
+
+    Priority = 1;
+    if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
+        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)) ||
+        ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_CFD) && (config->GetMarker_All_DV(iMarker) == YES)) ||
+        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DOT))) Priority = 2;
+    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) Priority = 3;
+    if ((config->GetMarker_All_FSIinterface(iMarker) != 0) && (Kind_SU2 == SU2_CFD)) Priority = 4;
+
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (Priority < Point_Priority[iPoint]) continue;
+      Point_Priority[iPoint] = Priority;
+      VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        Point_Disp[iPoint*nDim+iDim] = ((Priority == 2) || (Priority == 4)) ? VarCoord[iDim] : 0.0;
+    }
+  }
+
+  /*--- All the ranks need the control points (boundary points of the domain),
+   the buffers have the size of the largest rank ---*/
+
+  nLocal = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (Point_Priority[iPoint] > 0) nLocal++;
+
+  nMaxLocal = nLocal;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nLocal, &nMaxLocal, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  vector<su2double> Buffer_Send(2*nDim*nMaxLocal+1, 0.0), Buffer_Recv(size*(2*nDim*nMaxLocal+1), 0.0);
+
+  Buffer_Send[0] = su2double(nLocal);
+  iControl = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (Point_Priority[iPoint] == 0) continue;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Buffer_Send[1+2*nDim*iControl+iDim] = geometry->node[iPoint]->GetCoord(iDim);
+      Buffer_Send[1+2*nDim*iControl+nDim+iDim] = Point_Disp[iPoint*nDim+iDim];
+    }
+    iControl++;
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&Buffer_Send[0], int(2*nDim*nMaxLocal+1), MPI_DOUBLE, &Buffer_Recv[0], int(2*nDim*nMaxLocal+1), MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  Buffer_Recv = Buffer_Send;
+#endif
+
+  vector<su2double> Control_Coord, Control_Disp;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    su2double *Buffer = &Buffer_Recv[iProcessor*(2*nDim*nMaxLocal+1)];
+    for (iControl = 0; iControl < (unsigned long)(SU2_TYPE::Int(Buffer[0])); iControl++)
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Control_Coord.push_back(Buffer[1+2*nDim*iControl+iDim]);
+        Control_Disp.push_back(Buffer[1+2*nDim*iControl+nDim+iDim]);
+      }
+  }
+  nControl = Control_Coord.size()/nDim;
+
+  /*--- Support radius, by default the diagonal of the bounding box of the
+   boundary (global support) ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++) { Box_Min[iDim] = 0.0; Box_Max[iDim] = 0.0; }
+  for (iControl = 0; iControl < nControl; iControl++) {
+    Value = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Value += pow(Control_Disp[iControl*nDim+iDim], 2.0);
+      if ((iControl == 0) || (Control_Coord[iControl*nDim+iDim] < Box_Min[iDim])) Box_Min[iDim] = Control_Coord[iControl*nDim+iDim];
+      if ((iControl == 0) || (Control_Coord[iControl*nDim+iDim] > Box_Max[iDim])) Box_Max[iDim] = Control_Coord[iControl*nDim+iDim];
+    }
+    MaxDisp = max(MaxDisp, sqrt(Value));
+  }
+
+  if (Radius <= 0.0) {
+    Radius = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Radius += pow(Box_Max[iDim]-Box_Min[iDim], 2.0);
+    Radius = sqrt(Radius);
+  }
+
+  /*--- Greedy selection of the control points: the points with the largest
+   interpolation error are added (up to 10% of the current set at a time) until
+   the error is below DEFORM_RBF_TOLERANCE times the maximum displacement. The
+   interpolation matrix is symmetric positive definite (Cholesky). ---*/
+
+  vector<unsigned long> Selected;
+  vector<bool> Is_Selected(nControl, false);
+  vector<su2double> Control_Error(nControl, 0.0), Matrix, Coeff;
+  vector<pair<su2double, unsigned long> > Candidate;
+
+  for (iControl = 0; iControl < nControl; iControl++) {
+    Value = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Value += pow(Control_Disp[iControl*nDim+iDim], 2.0);
+    Control_Error[iControl] = sqrt(Value);
+  }
+
+  if (MaxPoints == 0) MaxPoints = nControl;
+  nAdd = 1;
+
+  while ((MaxDisp > 0.0) && (Selected.size() < min(MaxPoints, nControl))) {
+
+    /*--- Add the points with the largest error ---*/
+
+    Candidate.clear();
+    for (iControl = 0; iControl < nControl; iControl++)
+      if (!Is_Selected[iControl]) Candidate.push_back(make_pair(-Control_Error[iControl], iControl));
+    nAdd = min(nAdd, min((unsigned long)Candidate.size(), MaxPoints-Selected.size()));
+    partial_sort(Candidate.begin(), Candidate.begin()+nAdd, Candidate.end());
+    for (iControl = 0; iControl < nAdd; iControl++) {
+      Selected.push_back(Candidate[iControl].second);
+      Is_Selected[Candidate[iControl].second] = true;
+    }
+    nSelected = Selected.size();
+
+    /*--- Interpolation matrix and its Cholesky factorization (lower triangle) ---*/
+
+    Matrix.assign(nSelected*nSelected, 0.0);
+    for (iSelected = 0; iSelected < nSelected; iSelected++)
+      for (jSelected = 0; jSelected <= iSelected; jSelected++) {
+        Dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Dist += pow(Control_Coord[Selected[iSelected]*nDim+iDim]-Control_Coord[Selected[jSelected]*nDim+iDim], 2.0);
+        Matrix[iSelected*nSelected+jSelected] = GetRadialBasis(Kind_RBF, sqrt(Dist), Radius);
+      }
+
+    bool Positive = true;
+    for (jSelected = 0; jSelected < nSelected && Positive; jSelected++) {
+      for (unsigned long kSelected = 0; kSelected < jSelected; kSelected++)
+        Matrix[jSelected*nSelected+jSelected] -= pow(Matrix[jSelected*nSelected+kSelected], 2.0);
+      if (Matrix[jSelected*nSelected+jSelected] <= 0.0) { Positive = false; break; }
+      Matrix[jSelected*nSelected+jSelected] = sqrt(Matrix[jSelected*nSelected+jSelected]);
+      for (iSelected = jSelected+1; iSelected < nSelected; iSelected++) {
+        for (unsigned long kSelected = 0; kSelected < jSelected; kSelected++)
+          Matrix[iSelected*nSelected+jSelected] -= Matrix[iSelected*nSelected+kSelected]*Matrix[jSelected*nSelected+kSelected];
+        Matrix[iSelected*nSelected+jSelected] /= Matrix[jSelected*nSelected+jSelected];
+      }
+    }
+
+    /*--- Duplicated points make the matrix singular, stop with the previous set ---*/
+
+    if (!Positive) {
+      for (iControl = 0; iControl < nAdd; iControl++) {
+        Is_Selected[Selected.back()] = false;
+        Selected.pop_back();
+      }
+      break;
+    }
+
+    /*--- Coefficients (forward and backward substitution, one per dimension) ---*/
+
+    Coeff.assign(nSelected*nDim, 0.0);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (iSelected = 0; iSelected < nSelected; iSelected++) {
+        Value = Control_Disp[Selected[iSelected]*nDim+iDim];
+        for (jSelected = 0; jSelected < iSelected; jSelected++)
+          Value -= Matrix[iSelected*nSelected+jSelected]*Coeff[jSelected*nDim+iDim];
+        Coeff[iSelected*nDim+iDim] = Value/Matrix[iSelected*nSelected+iSelected];
+      }
+      for (iSelected = nSelected; iSelected-- > 0; ) {
+        Value = Coeff[iSelected*nDim+iDim];
+        for (jSelected = iSelected+1; jSelected < nSelected; jSelected++)
+          Value -= Matrix[jSelected*nSelected+iSelected]*Coeff[jSelected*nDim+iDim];
+        Coeff[iSelected*nDim+iDim] = Value/Matrix[iSelected*nSelected+iSelected];
+      }
+    }
+
+    /*--- Interpolation error at the control points ---*/
+
+    MaxError = 0.0;
+    for (iControl = 0; iControl < nControl; iControl++) {
+      su2double Interp[3] = {0.0, 0.0, 0.0};
+      for (iSelected = 0; iSelected < nSelected; iSelected++) {
+        Dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Dist += pow(Control_Coord[iControl*nDim+iDim]-Control_Coord[Selected[iSelected]*nDim+iDim], 2.0);
+        Value = GetRadialBasis(Kind_RBF, sqrt(Dist), Radius);
+        for (iDim = 0; iDim < nDim; iDim++) Interp[iDim] += Coeff[iSelected*nDim+iDim]*Value;
+      }
+      Error = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) Error += pow(Control_Disp[iControl*nDim+iDim]-Interp[iDim], 2.0);
+      Control_Error[iControl] = sqrt(Error);
+      MaxError = max(MaxError, Control_Error[iControl]);
+    }
+
+    if (MaxError <= Tol*MaxDisp) break;
+
+    nAdd = max((unsigned long)1, nSelected/10);
+
+  }
+
+  nSelected = Selected.size();
+  if (MaxDisp == 0.0) Coeff.clear();
+
+  /*--- Evaluation of the displacement at all the points of the partition
+   (halos included, no communication and no linear system) ---*/
+
+  LinSysSol.SetValZero();
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Coord = geometry->node[iPoint]->GetCoord();
+    if (Point_Priority[iPoint] > 0) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[iPoint*nDim+iDim] = Point_Disp[iPoint*nDim+iDim];
+      continue;
+    }
+    for (iSelected = 0; iSelected < nSelected; iSelected++) {
+      Dist = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Dist += pow(Coord[iDim]-Control_Coord[Selected[iSelected]*nDim+iDim], 2.0);
+      if (Dist >= Radius*Radius) continue;
+      Value = GetRadialBasis(Kind_RBF, sqrt(Dist), Radius);
+      for (iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[iPoint*nDim+iDim] += Coeff[iSelected*nDim+iDim]*Value;
+    }
+  }
+
+  /*--- The points of the symmetry planes slide in the plane ---*/
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) continue;
+    for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      VarCoord = geometry->node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        MeanCoord[iDim] += VarCoord[iDim]*VarCoord[iDim];
+    }
+    for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+    axis = 0;
+    for (iDim = 1; iDim < nDim; iDim++)
+      if (MeanCoord[iDim] < MeanCoord[axis]) axis = iDim;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (Point_Priority[iPoint] < 2) LinSysSol[iPoint*nDim+axis] = 0.0;
+    }
+  }
+
+  /*--- Fix the location of any points in the domain, if requested. ---*/
+
+  if (config->GetHold_GridFixed()) {
+    su2double *Hold_GridFixed_Coord = config->GetHold_GridFixed_Coord();
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Coord = geometry->node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        if ((Coord[iDim] < Hold_GridFixed_Coord[iDim]) || (Coord[iDim] > Hold_GridFixed_Coord[iDim+3])) {
+          total_index = iPoint*nDim + iDim;
+          LinSysSol[total_index] = 0.0;
+        }
+    }
+  }
+
+  /*--- Update the grid coordinates and cell volumes ---*/
+
+  UpdateGridCoord(geometry, config);
+
+  if (UpdateGeo)
+    UpdateDualGrid(geometry, config);
+
+  /*--- Check for failed deformation (negative volumes). ---*/
+
+  ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume);
+
+  Set_nIterMesh(nSelected);
+
+  if (rank == MASTER_NODE) {
+    cout << "RBF deformation: " << nSelected << "/" << nControl << " control points. ";
+    if (nDim == 2) cout << "Min. area: " << MinVolume << ". Error: " << MaxError << "." << endl;
+    else cout << "Min. volume: " << MinVolume << ". Error: " << MaxError << "." << endl;
+  }
+
+}
+
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume) {
   
   unsigned long iElem, ElemCounter = 0, PointCorners[8];
@@ -2699,6 +3079,7 @@ CSurfaceMovement::CSurfaceMovement(void) : CGridMovement() {
 	nFFDBox = 0;
   nLevel = 0;
 	FFDBoxDefinition = false;
+  FFDSurfaceUpdate = true;
 }
 
 CSurfaceMovement::~CSurfaceMovement(void) {}
@@ -2891,9 +3272,12 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
               }
             }
             
-            /*--- Recompute cartesian coordinates using the new control point location ---*/
+            /*--- Recompute cartesian coordinates using the new control point location
+             (the projection of the sensitivities only needs the control points) ---*/
             
-            SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox);
+            if (FFDSurfaceUpdate || (FFDBox[iFFDBox]->GetnParentFFDBox() != 0) ||
+                (FFDBox[iFFDBox]->GetnChildFFDBox() != 0))
+              SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox);
             
             /*--- Reparametrization of the parent FFD box ---*/
             
@@ -3122,8 +3506,9 @@ void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
 void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
   
 	unsigned short iMarker, iDim, iOrder, jOrder, kOrder, lOrder, mOrder, nOrder;
-	unsigned long iVertex, iPoint, TotalVertex = 0;
-	su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
+	unsigned long iVertex, iPoint, iSurfacePoints, nNewton = 0, nIterative = 0, my_nCount[2], nCount[2];
+	su2double *CartCoordNew, *CartCoordOld, *ParamCoord, CartCoord[3], ParamCoordGuess[3], ParamCoordCenter[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
+	bool Cache = false;
 	int rank;
   unsigned short nDim = geometry->GetnDim();
   
@@ -3157,88 +3542,119 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
   FFDBox->SetlOrder(2); FFDBox->SetmOrder(2); FFDBox->SetnOrder(2);
   FFDBox->SetnControlPoints();
   
-  /*--- Point inversion algorithm with a basic box ---*/
-  
-	ParamCoordGuess[0]  = 0.5; ParamCoordGuess[1] = 0.5; ParamCoordGuess[2] = 0.5;
-  CartCoord[0]        = 0.0; CartCoord[1]       = 0.0; CartCoord[2]       = 0.0;
-
-  /*--- Count the number of vertices ---*/
+  /*--- Try first the parametric coordinates of a previous run (same mesh and box) ---*/
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-		if (config->GetMarker_All_DV(iMarker) == YES)
-			for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
-        TotalVertex++;
+  if (config->GetFFD_ParamCache())
+    Cache = ReadParametricCoord(geometry, config, FFDBox);
   
-	for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  if (!Cache) {
     
-		if (config->GetMarker_All_DV(iMarker) == YES) {
+    /*--- Point inversion algorithm with a basic box, the bounding box of the corners
+     discards most of the surface before the (more expensive) test with the tetrahedra ---*/
+    
+    FFDBox->SetBoundingBox();
+    
+    ParamCoordCenter[0] = 0.5; ParamCoordCenter[1] = 0.5; ParamCoordCenter[2] = 0.5;
+    ParamCoordGuess[0]  = 0.5; ParamCoordGuess[1]  = 0.5; ParamCoordGuess[2]  = 0.5;
+    CartCoord[0]        = 0.0; CartCoord[1]        = 0.0; CartCoord[2]        = 0.0;
+    
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       
-			for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        
-        /*--- Get the cartesian coordinates ---*/
-        
-        for (iDim = 0; iDim < nDim; iDim++)
-          CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
-        
-				iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-				
-				/*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
+      if (config->GetMarker_All_DV(iMarker) == YES) {
         
-				if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
           
-					/*--- Find the parametric coordinate ---*/
+          /*--- Get the cartesian coordinates ---*/
           
-					ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+          for (iDim = 0; iDim < nDim; iDim++)
+            CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
           
-					/*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox ---*/
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
           
-					if (((ParamCoord[0] >= - EPS) && (ParamCoord[0] <= 1.0 + EPS)) && 
-							((ParamCoord[1] >= - EPS) && (ParamCoord[1] <= 1.0 + EPS)) && 
-							((ParamCoord[2] >= - EPS) && (ParamCoord[2] <= 1.0 + EPS))) {
-						
-						/*--- Set the value of the parametric coordinate ---*/
+          /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
+          
+          if (FFDBox->GetPointBoundingBox(CartCoord) && FFDBox->GetPointFFD(geometry, config, iPoint)) {
             
-						FFDBox->Set_MarkerIndex(iMarker);
-						FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-						FFDBox->Set_ParametricCoord(ParamCoord);
-						FFDBox->Set_CartesianCoord(CartCoord);						
-						
-						/*--- Compute the cartesian coordinates using the parametric coordinates 
-						 to check that everithing is right ---*/
+            /*--- Find the parametric coordinate, Newton method (trilinear box) starting from the
+             previous surface point (neighbor in the marker), then from the center of the box, and
+             the robust (but slow) minimization only if both fail ---*/
             
-						CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
-						
-						/*--- Compute max difference between original value and the recomputed value ---*/
+            ParamCoord = FFDBox->GetParametricCoord_Newton(CartCoord, ParamCoordGuess, config);
+            if (ParamCoord == NULL)
+              ParamCoord = FFDBox->GetParametricCoord_Newton(CartCoord, ParamCoordCenter, config);
+            if (ParamCoord == NULL) {
+              ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordCenter, config);
+              nIterative++;
+            }
+            else nNewton++;
             
-						Diff = 0.0;
-						for (iDim = 0; iDim < nDim; iDim++)
-							Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-						Diff = sqrt(Diff);
-						my_MaxDiff = max(my_MaxDiff, Diff);
-						
-						ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+            /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox ---*/
+            
+            if (((ParamCoord[0] >= - EPS) && (ParamCoord[0] <= 1.0 + EPS)) &&
+                ((ParamCoord[1] >= - EPS) && (ParamCoord[1] <= 1.0 + EPS)) &&
+                ((ParamCoord[2] >= - EPS) && (ParamCoord[2] <= 1.0 + EPS))) {
+              
+              /*--- Set the value of the parametric coordinate ---*/
+              
+              FFDBox->Set_MarkerIndex(iMarker);
+              FFDBox->Set_VertexIndex(iVertex);
+              FFDBox->Set_PointIndex(iPoint);
+              FFDBox->Set_ParametricCoord(ParamCoord);
+              FFDBox->Set_CartesianCoord(CartCoord);
+              
+              ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+              
+            }
+            else {
+              cout << "Please check this point: (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> ("
+              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<")."<< endl;
+            }
             
-					}
-          else {
-            cout << "Please check this point: (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> ("
-            << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<")."<< endl;
           }
-          
-				}
-			}
+        }
+      }
     }
+    
   }
-		
+  
+  /*--- Compute the cartesian coordinates using the parametric coordinates
+   to check that everithing is right ---*/
+  
+  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+    
+    CartCoordOld = FFDBox->Get_CartesianCoord(iSurfacePoints);
+    CartCoordNew = FFDBox->EvalCartesianCoord(FFDBox->Get_ParametricCoord(iSurfacePoints));
+    
+    /*--- Compute max difference between original value and the recomputed value ---*/
+    
+    Diff = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Diff += (CartCoordNew[iDim]-CartCoordOld[iDim])*(CartCoordNew[iDim]-CartCoordOld[iDim]);
+    Diff = sqrt(Diff);
+    my_MaxDiff = max(my_MaxDiff, Diff);
+    
+  }
+  
+  my_nCount[0] = nNewton; my_nCount[1] = nIterative;
+  
 #ifdef HAVE_MPI
 	SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+	SU2_MPI::Allreduce(my_nCount, nCount, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 #else
 	MaxDiff = my_MaxDiff;
+	nCount[0] = my_nCount[0]; nCount[1] = my_nCount[1];
 #endif
 	
-	if (rank == MASTER_NODE) 
+	if (rank == MASTER_NODE) {
 		cout << "Compute parametric coord      | FFD box: " << FFDBox->GetTag() << ". Max Diff: " << MaxDiff <<"."<< endl;
+		if (nCount[0]+nCount[1] != 0)
+			cout << "Point inversion               | Newton (trilinear box): " << nCount[0] << " points. Minimization: " << nCount[1] << " points." << endl;
+	}
   
+  /*--- Store the parametric coordinates for the next run on this mesh ---*/
+  
+  if (config->GetFFD_ParamCache() && !Cache)
+    WriteParametricCoord(geometry, config, FFDBox);
   
   /*--- After the point inversion, copy the original information back ---*/
   
@@ -3246,9 +3662,186 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 	
 }
 
+string CSurfaceMovement::GetParametricCoord_FileName(CConfig *config, CFreeFormDefBox *FFDBox) {
+  
+  string filename = config->GetMesh_FileName();
+  char buffer_char[50];
+  int size = SINGLE_NODE, rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Remove the extension of the mesh file, one file per box (and per rank, since
+   the file only stores the points of the local partition) ---*/
+  
+  unsigned short lastindex = filename.find_last_of(".");
+  filename = filename.substr(0, lastindex) + "_ffd_" + FFDBox->GetTag();
+  
+  if (size > 1) {
+    SPRINTF (buffer_char, "_%d", SU2_TYPE::Int(rank+1));
+    filename = filename + buffer_char;
+  }
+  
+  return filename + ".dat";
+  
+}
+
+bool CSurfaceMovement::ReadParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox) {
+  
+  unsigned short iMarker, iDim, iCornerPoints, nCornerPoints;
+  unsigned long iVertex, iPoint, iSurfacePoints, nSurfacePoints, nVertex, TotalVertex = 0, GlobalIndex;
+  su2double Corner[3], CartCoord[3], ParamCoord[3], *Coord, Scale = 0.0, Tol;
+  string text_line, Marker_Tag, Box_Tag;
+  bool Match = true, my_Match, all_Match;
+  ifstream cache_file;
+  
+  vector<unsigned short> Cache_Marker;
+  vector<unsigned long> Cache_Vertex;
+  vector<su2double> Cache_CartCoord, Cache_ParamCoord;
+  
+  string filename = GetParametricCoord_FileName(config, FFDBox);
+  
+  /*--- Size of the box, for the tolerance of the coordinate comparison ---*/
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    Scale = max(Scale, fabs(FFDBox->GetCoordCornerPoints(iDim, 6)-FFDBox->GetCoordCornerPoints(iDim, 0)));
+  Tol = 1E-10*max(Scale, su2double(1.0));
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if (config->GetMarker_All_DV(iMarker) == YES)
+      TotalVertex += geometry->nVertex[iMarker];
+  
+  cache_file.open(filename.c_str(), ios::in);
+  
+  if (cache_file.fail()) Match = false;
+  
+  /*--- Header: box tag, corner points and number of vertices of the design markers ---*/
+  
+  if (Match) {
+    cache_file >> text_line >> Box_Tag >> text_line >> nCornerPoints;
+    if (cache_file.fail() || (Box_Tag != FFDBox->GetTag()) || (nCornerPoints != FFDBox->GetnCornerPoints())) Match = false;
+  }
+  
+  if (Match) {
+    for (iCornerPoints = 0; iCornerPoints < nCornerPoints; iCornerPoints++) {
+      cache_file >> Corner[0] >> Corner[1] >> Corner[2];
+      for (iDim = 0; iDim < 3; iDim++)
+        if (fabs(Corner[iDim]-FFDBox->GetCoordCornerPoints(iDim, iCornerPoints)) > Tol) Match = false;
+    }
+    cache_file >> text_line >> nVertex >> text_line >> nSurfacePoints;
+    if (cache_file.fail() || (nVertex != TotalVertex)) Match = false;
+  }
+  
+  /*--- Surface points, they must be the same vertices with the same coordinates ---*/
+  
+  if (Match) {
+    for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
+      cache_file >> Marker_Tag >> iVertex >> GlobalIndex
+      >> CartCoord[0] >> CartCoord[1] >> CartCoord[2] >> ParamCoord[0] >> ParamCoord[1] >> ParamCoord[2];
+      if (cache_file.fail()) { Match = false; break; }
+      if (config->GetMarker_All_TagBound(Marker_Tag) == -1) { Match = false; break; }
+      iMarker = config->GetMarker_All_TagBound(Marker_Tag);
+      if ((config->GetMarker_All_DV(iMarker) != YES) || (iVertex >= geometry->nVertex[iMarker])) { Match = false; break; }
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->node[iPoint]->GetGlobalIndex() != GlobalIndex) { Match = false; break; }
+      Coord = geometry->node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
+        if (fabs(Coord[iDim]-CartCoord[iDim]) > Tol) Match = false;
+      if (!Match) break;
+      Cache_Marker.push_back(iMarker);
+      Cache_Vertex.push_back(iVertex);
+      for (iDim = 0; iDim < 3; iDim++) {
+        Cache_CartCoord.push_back(CartCoord[iDim]);
+        Cache_ParamCoord.push_back(ParamCoord[iDim]);
+      }
+    }
+  }
+  
+  if (cache_file.is_open()) cache_file.close();
+  
+  /*--- All the ranks must agree, otherwise the inversion is repeated everywhere
+   (a different partition would leave some points out of the files) ---*/
+  
+  my_Match = Match;
+#ifdef HAVE_MPI
+  int my_Match_Int = my_Match, all_Match_Int;
+  SU2_MPI::Allreduce(&my_Match_Int, &all_Match_Int, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  all_Match = (all_Match_Int == 1);
+#else
+  all_Match = my_Match;
+#endif
+  
+  if (!all_Match) return false;
+  
+  for (iSurfacePoints = 0; iSurfacePoints < Cache_Marker.size(); iSurfacePoints++) {
+    iMarker = Cache_Marker[iSurfacePoints]; iVertex = Cache_Vertex[iSurfacePoints];
+    FFDBox->Set_MarkerIndex(iMarker);
+    FFDBox->Set_VertexIndex(iVertex);
+    FFDBox->Set_PointIndex(geometry->vertex[iMarker][iVertex]->GetNode());
+    FFDBox->Set_ParametricCoord(&Cache_ParamCoord[3*iSurfacePoints]);
+    FFDBox->Set_CartesianCoord(&Cache_CartCoord[3*iSurfacePoints]);
+  }
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  if (rank == MASTER_NODE)
+    cout << "Read parametric coord (cache) | FFD box: " << FFDBox->GetTag() << "." << endl;
+  
+  return true;
+  
+}
+
+void CSurfaceMovement::WriteParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox) {
+  
+  unsigned short iMarker, iDim, iCornerPoints;
+  unsigned long iSurfacePoints, iPoint, TotalVertex = 0;
+  su2double *CartCoord, *ParamCoord;
+  ofstream cache_file;
+  
+  string filename = GetParametricCoord_FileName(config, FFDBox);
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if (config->GetMarker_All_DV(iMarker) == YES)
+      TotalVertex += geometry->nVertex[iMarker];
+  
+  cache_file.open(filename.c_str(), ios::out);
+  cache_file.precision(17);
+  cache_file.setf(ios::scientific);
+  
+  cache_file << "FFD_TAG= " << FFDBox->GetTag() << endl;
+  cache_file << "FFD_CORNER_POINTS= " << FFDBox->GetnCornerPoints() << endl;
+  for (iCornerPoints = 0; iCornerPoints < FFDBox->GetnCornerPoints(); iCornerPoints++) {
+    for (iDim = 0; iDim < 3; iDim++)
+      cache_file << FFDBox->GetCoordCornerPoints(iDim, iCornerPoints) << "\t";
+    cache_file << endl;
+  }
+  cache_file << "DV_VERTICES= " << TotalVertex << endl;
+  cache_file << "FFD_SURFACE_POINTS= " << FFDBox->GetnSurfacePoint() << endl;
+  
+  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+    cache_file << config->GetMarker_All_TagBound(iMarker) << "\t" << FFDBox->Get_VertexIndex(iSurfacePoints) << "\t"
+    << geometry->node[iPoint]->GetGlobalIndex();
+    CartCoord = FFDBox->Get_CartesianCoord(iSurfacePoints);
+    for (iDim = 0; iDim < 3; iDim++) cache_file << "\t" << CartCoord[iDim];
+    ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+    for (iDim = 0; iDim < 3; iDim++) cache_file << "\t" << ParamCoord[iDim];
+    cache_file << endl;
+  }
+  
+  cache_file.close();
+  
+}
+
 void CSurfaceMovement::SetParametricCoordCP(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBoxParent, CFreeFormDefBox *FFDBoxChild) {
 	unsigned short iOrder, jOrder, kOrder;
-	su2double *CartCoord, *ParamCoord, ParamCoordGuess[3];
+	su2double *CartCoord, *ParamCoord, ParamCoordGuess[3] = {0.5, 0.5, 0.5};
 	int rank;
 
 #ifdef HAVE_MPI
@@ -3622,7 +4215,7 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
 void CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
   
 	su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-	*ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+	VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
 	unsigned short iMarker, iDim;
 	unsigned long iVertex, iPoint, iSurfacePoints;
 	int rank;
@@ -3654,14 +4247,10 @@ void CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, C
       
 			geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
       
-			/*--- Get the parametric coordinate of the surface point ---*/
-      
-			ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
-			
-			/*--- Compute the new cartesian coordinate, and set the value in
-			 the FFDBox structure ---*/
+			/*--- Compute the new cartesian coordinate (sparse product of the basis
+			 operator and the control points), and set the value in the FFDBox structure ---*/
       
-			CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+			CartCoordNew = FFDBox->EvalCartesianCoord(iSurfacePoints);
 			FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
 			
 			/*--- Get the original cartesian coordinates of the surface point ---*/
@@ -6523,7 +7112,7 @@ void CSurfaceMovement::MergeFFDInfo(CGeometry *geometry, CConfig *config) {
       GlobalCoordX[iFFDBox].push_back(FFDBox[iFFDBox]->Get_ParametricCoord(iPoint)[0]);
       GlobalCoordY[iFFDBox].push_back(FFDBox[iFFDBox]->Get_ParametricCoord(iPoint)[1]);
       GlobalCoordZ[iFFDBox].push_back(FFDBox[iFFDBox]->Get_ParametricCoord(iPoint)[2]);
-      GlobalPoint[iFFDBox].push_back(FFDBox[iFFDBox]->Get_PointIndex(iPoint));
+      GlobalPoint[iFFDBox].push_back(geometry->node[FFDBox[iFFDBox]->Get_PointIndex(iPoint)]->GetGlobalIndex());
       
       /*--- Marker of the boundary in the local domain. ---*/
       
@@ -6825,7 +7414,7 @@ void CSurfaceMovement::WriteFFDInfo(CGeometry *geometry, CConfig *config) {
 
 }
 
-CFreeFormDefBox::CFreeFormDefBox(void) : CGridMovement() { }
+CFreeFormDefBox::CFreeFormDefBox(void) : CGridMovement() { Basis_Set = false; }
 
 CFreeFormDefBox::CFreeFormDefBox(unsigned short val_lDegree, unsigned short val_mDegree, unsigned short val_nDegree) : CGridMovement() {
   
@@ -6856,6 +7445,8 @@ CFreeFormDefBox::CFreeFormDefBox(unsigned short val_lDegree, unsigned short val_
 	nDegree_Copy = val_nDegree; nOrder_Copy = nDegree+1;
 	nControlPoints_Copy = lOrder_Copy*mOrder_Copy*nOrder_Copy;
 	
+	Basis_Set = false;
+	
 	Coord_Control_Points = new su2double*** [lOrder];
 	ParCoord_Control_Points = new su2double*** [lOrder];
 	Coord_Control_Points_Copy = new su2double*** [lOrder];
@@ -7154,6 +7745,90 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) {
 	return cart_coord;
 }
 
+void CFreeFormDefBox::SetBasis(void) {
+  
+  unsigned short iDegree, jDegree, kDegree;
+  unsigned long iSurfacePoints, nSurfacePoint = GetnSurfacePoint();
+  su2double Weight;
+  
+  vector<su2double> Basis_l(lOrder), Basis_m(mOrder), Basis_n(nOrder);
+  
+  Basis_Begin.assign(1, 0);
+  Basis_ControlPoint.clear();
+  Basis_Weight.clear();
+  
+  for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoint; iSurfacePoints++) {
+    
+    /*--- The Bernstein polynomials are evaluated once per direction ---*/
+    
+    for (iDegree = 0; iDegree <= lDegree; iDegree++)
+      Basis_l[iDegree] = GetBernstein(lDegree, iDegree, ParametricCoord[0][iSurfacePoints]);
+    for (jDegree = 0; jDegree <= mDegree; jDegree++)
+      Basis_m[jDegree] = GetBernstein(mDegree, jDegree, ParametricCoord[1][iSurfacePoints]);
+    for (kDegree = 0; kDegree <= nDegree; kDegree++)
+      Basis_n[kDegree] = GetBernstein(nDegree, kDegree, ParametricCoord[2][iSurfacePoints]);
+    
+    /*--- Only the control points with a nonzero weight are stored ---*/
+    
+    for (iDegree = 0; iDegree <= lDegree; iDegree++)
+      for (jDegree = 0; jDegree <= mDegree; jDegree++)
+        for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+          Weight = Basis_l[iDegree]*Basis_m[jDegree]*Basis_n[kDegree];
+          if (Weight == 0.0) continue;
+          Basis_ControlPoint.push_back((iDegree*mOrder+jDegree)*nOrder+kDegree);
+          Basis_Weight.push_back(Weight);
+        }
+    
+    Basis_Begin.push_back(Basis_Weight.size());
+    
+  }
+  
+  Basis_Set = true;
+  
+}
+
+su2double *CFreeFormDefBox::EvalCartesianCoord(unsigned long val_iSurfacePoints) {
+  
+  unsigned short iDim, iDegree, jDegree, kDegree;
+  unsigned long iWeight, iControlPoint;
+  
+  if (!Basis_Set) SetBasis();
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    cart_coord[iDim] = 0.0;
+  
+  for (iWeight = Basis_Begin[val_iSurfacePoints]; iWeight < Basis_Begin[val_iSurfacePoints+1]; iWeight++) {
+    iControlPoint = Basis_ControlPoint[iWeight];
+    kDegree = iControlPoint % nOrder;
+    jDegree = (iControlPoint / nOrder) % mOrder;
+    iDegree = iControlPoint / (nOrder*mOrder);
+    for (iDim = 0; iDim < nDim; iDim++)
+      cart_coord[iDim] += Basis_Weight[iWeight]*Coord_Control_Points[iDegree][jDegree][kDegree][iDim];
+  }
+  
+  return cart_coord;
+  
+}
+
+void CFreeFormDefBox::GetBasis_TransposedProduct(su2double *val_surface, su2double *val_control) {
+  
+  unsigned short iDim;
+  unsigned long iSurfacePoints, iWeight, iControlPoint;
+  
+  if (!Basis_Set) SetBasis();
+  
+  for (iControlPoint = 0; iControlPoint < (unsigned long)(lOrder*mOrder*nOrder*nDim); iControlPoint++)
+    val_control[iControlPoint] = 0.0;
+  
+  for (iSurfacePoints = 0; iSurfacePoints < GetnSurfacePoint(); iSurfacePoints++)
+    for (iWeight = Basis_Begin[iSurfacePoints]; iWeight < Basis_Begin[iSurfacePoints+1]; iWeight++) {
+      iControlPoint = Basis_ControlPoint[iWeight];
+      for (iDim = 0; iDim < nDim; iDim++)
+        val_control[iControlPoint*nDim+iDim] += Basis_Weight[iWeight]*val_surface[iSurfacePoints*nDim+iDim];
+    }
+  
+}
+
 su2double CFreeFormDefBox::GetBernstein(short val_n, short val_i, su2double val_t) {
   
   su2double value = 0.0;
@@ -7386,6 +8061,85 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   
 }
 
+su2double *CFreeFormDefBox::GetParametricCoord_Newton(su2double *xyz, su2double *guess, CConfig *config) {
+  
+  unsigned short iDim, jDim, iOrder, jOrder, kOrder, iter;
+  su2double Basis[3][2], dBasis[2] = {-1.0, 1.0}, Jacobian[3][3], AdjJacobian[3][3], Residual[3], Delta[3], Determinant, *Coord;
+  
+  su2double tol = config->GetFFD_Tol();
+  unsigned short it_max = config->GetnFFD_Iter();
+  
+  /*--- Only for the box reduced to its corner points ---*/
+  
+  if ((lOrder != 2) || (mOrder != 2) || (nOrder != 2)) return NULL;
+  
+  for (iDim = 0; iDim < 3; iDim++) ParamCoord[iDim] = guess[iDim];
+  
+  for (iter = 0; iter < it_max; iter++) {
+    
+    /*--- Linear Bernstein polynomials (1-t, t) in each direction ---*/
+    
+    for (iDim = 0; iDim < 3; iDim++) {
+      Basis[iDim][0] = 1.0 - ParamCoord[iDim]; Basis[iDim][1] = ParamCoord[iDim];
+    }
+    
+    /*--- Residual x(u,v,w) - xyz and analytic Jacobian of the trilinear map ---*/
+    
+    for (iDim = 0; iDim < 3; iDim++) {
+      Residual[iDim] = -xyz[iDim];
+      for (jDim = 0; jDim < 3; jDim++) Jacobian[iDim][jDim] = 0.0;
+    }
+    
+    for (iOrder = 0; iOrder < 2; iOrder++)
+      for (jOrder = 0; jOrder < 2; jOrder++)
+        for (kOrder = 0; kOrder < 2; kOrder++) {
+          Coord = Coord_Control_Points[iOrder][jOrder][kOrder];
+          for (iDim = 0; iDim < 3; iDim++) {
+            Residual[iDim]    += Basis[0][iOrder]*Basis[1][jOrder]*Basis[2][kOrder]*Coord[iDim];
+            Jacobian[iDim][0] += dBasis[iOrder]*Basis[1][jOrder]*Basis[2][kOrder]*Coord[iDim];
+            Jacobian[iDim][1] += Basis[0][iOrder]*dBasis[jOrder]*Basis[2][kOrder]*Coord[iDim];
+            Jacobian[iDim][2] += Basis[0][iOrder]*Basis[1][jOrder]*dBasis[kOrder]*Coord[iDim];
+          }
+        }
+    
+    /*--- Newton step, solve Jacobian Delta = -Residual with the adjoint matrix ---*/
+    
+    AdjJacobian[0][0] = Jacobian[1][1]*Jacobian[2][2]-Jacobian[1][2]*Jacobian[2][1];
+    AdjJacobian[0][1] = Jacobian[0][2]*Jacobian[2][1]-Jacobian[0][1]*Jacobian[2][2];
+    AdjJacobian[0][2] = Jacobian[0][1]*Jacobian[1][2]-Jacobian[0][2]*Jacobian[1][1];
+    AdjJacobian[1][0] = Jacobian[1][2]*Jacobian[2][0]-Jacobian[1][0]*Jacobian[2][2];
+    AdjJacobian[1][1] = Jacobian[0][0]*Jacobian[2][2]-Jacobian[0][2]*Jacobian[2][0];
+    AdjJacobian[1][2] = Jacobian[0][2]*Jacobian[1][0]-Jacobian[0][0]*Jacobian[1][2];
+    AdjJacobian[2][0] = Jacobian[1][0]*Jacobian[2][1]-Jacobian[1][1]*Jacobian[2][0];
+    AdjJacobian[2][1] = Jacobian[0][1]*Jacobian[2][0]-Jacobian[0][0]*Jacobian[2][1];
+    AdjJacobian[2][2] = Jacobian[0][0]*Jacobian[1][1]-Jacobian[0][1]*Jacobian[1][0];
+    
+    Determinant = Jacobian[0][0]*AdjJacobian[0][0]+Jacobian[0][1]*AdjJacobian[1][0]+Jacobian[0][2]*AdjJacobian[2][0];
+    
+    if (Determinant == 0.0) return NULL;
+    
+    for (iDim = 0; iDim < 3; iDim++) {
+      Delta[iDim] = 0.0;
+      for (jDim = 0; jDim < 3; jDim++)
+        Delta[iDim] -= AdjJacobian[iDim][jDim]*Residual[jDim]/Determinant;
+    }
+    
+    for (iDim = 0; iDim < 3; iDim++) ParamCoord[iDim] += Delta[iDim];
+    
+    /*--- Converged if the update is small, the iteration is abandoned if it
+     leaves the neighborhood of the box (bad guess) ---*/
+    
+    if ((fabs(Delta[0]) < tol) && (fabs(Delta[1]) < tol) && (fabs(Delta[2]) < tol)) return ParamCoord;
+    
+    for (iDim = 0; iDim < 3; iDim++)
+      if (fabs(ParamCoord[iDim]-0.5) > 10.0) return NULL;
+    
+  }
+  
+  return NULL;
+  
+}
+
 su2double CFreeFormDefBox::Binomial(unsigned short n, unsigned short m) {
   
   unsigned short i, j;
@@ -7454,6 +8208,40 @@ bool CFreeFormDefBox::GetPointFFD(CGeometry *geometry, CConfig *config, unsigned
 
 }
 
+void CFreeFormDefBox::SetBoundingBox(void) {
+  
+  unsigned short iDim, iCornerPoints;
+  su2double Margin;
+  
+  for (iDim = 0; iDim < 3; iDim++) {
+    MinCoord[iDim] = Coord_Corner_Points[0][iDim];
+    MaxCoord[iDim] = Coord_Corner_Points[0][iDim];
+    for (iCornerPoints = 1; iCornerPoints < nCornerPoints; iCornerPoints++) {
+      MinCoord[iDim] = min(MinCoord[iDim], Coord_Corner_Points[iCornerPoints][iDim]);
+      MaxCoord[iDim] = max(MaxCoord[iDim], Coord_Corner_Points[iCornerPoints][iDim]);
+    }
+  }
+  
+  /*--- Small margin, the points on the faces of the box must not be discarded ---*/
+  
+  for (iDim = 0; iDim < 3; iDim++) {
+    Margin = 1E-6*(MaxCoord[iDim]-MinCoord[iDim]);
+    MinCoord[iDim] -= Margin; MaxCoord[iDim] += Margin;
+  }
+  
+}
+
+bool CFreeFormDefBox::GetPointBoundingBox(su2double *xyz) {
+  
+  unsigned short iDim;
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    if ((xyz[iDim] < MinCoord[iDim]) || (xyz[iDim] > MaxCoord[iDim])) return false;
+  
+  return true;
+  
+}
+
 void CFreeFormDefBox::SetDeformationZone(CGeometry *geometry, CConfig *config, unsigned short iFFDBox) {
 	su2double *Coord;
 	unsigned short iMarker, iVar, jVar;
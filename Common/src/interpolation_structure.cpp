@@ -31,6 +31,213 @@
 
 #include "../include/interpolation_structure.hpp"
 
+/*--- Ordering of the points of the k-d tree along one coordinate direction ---*/
+class CKDTreeCompare {
+  const su2double *Coord;
+  unsigned short nDim, iDim;
+public:
+  CKDTreeCompare(const su2double *val_coord, unsigned short val_nDim, unsigned short val_iDim) :
+    Coord(val_coord), nDim(val_nDim), iDim(val_iDim) { }
+  bool operator()(unsigned long iPoint, unsigned long jPoint) const {
+    return Coord[iPoint*nDim+iDim] < Coord[jPoint*nDim+iDim];
+  }
+};
+
+CKDTree::CKDTree(unsigned long val_nPoint, unsigned short val_nDim, su2double *val_coord) {
+
+  unsigned long iPoint;
+
+  nDim   = val_nDim;
+  nPoint = val_nPoint;
+
+  Coord.assign(val_coord, val_coord+nPoint*nDim);
+  Index.resize(nPoint);
+  SplitDim.assign(nPoint, 0);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) Index[iPoint] = iPoint;
+
+  Build(0, nPoint);
+
+}
+
+CKDTree::~CKDTree(void) { }
+
+unsigned long CKDTree::GetnPoint(void) const { return nPoint; }
+
+void CKDTree::Build(unsigned long val_begin, unsigned long val_end) {
+
+  unsigned long iPoint, mid;
+  unsigned short iDim, maxDim = 0;
+  su2double Min[3], Max[3], maxExtent = -1.0;
+
+  if (val_end <= val_begin+1) return;
+
+  /*--- Split the range at its median along the direction of largest extent ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Min[iDim] = Coord[Index[val_begin]*nDim+iDim];
+    Max[iDim] = Min[iDim];
+  }
+  for (iPoint = val_begin+1; iPoint < val_end; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Min[iDim] = min(Min[iDim], Coord[Index[iPoint]*nDim+iDim]);
+      Max[iDim] = max(Max[iDim], Coord[Index[iPoint]*nDim+iDim]);
+    }
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    if (Max[iDim]-Min[iDim] > maxExtent) { maxExtent = Max[iDim]-Min[iDim]; maxDim = iDim; }
+  }
+
+  mid = val_begin + (val_end-val_begin)/2;
+  nth_element(Index.begin()+val_begin, Index.begin()+mid, Index.begin()+val_end,
+              CKDTreeCompare(&Coord[0], nDim, maxDim));
+  SplitDim[mid] = maxDim;
+
+  Build(val_begin, mid);
+  Build(mid+1, val_end);
+
+}
+
+unsigned long CKDTree::FindNearest(su2double *val_coord, su2double &val_dist) const {
+
+  unsigned long iPoint = nPoint;
+
+  val_dist = 0.0;
+  if (nPoint == 0) return iPoint;
+
+  val_dist = -1.0;
+  SearchNearest(0, nPoint, val_coord, iPoint, val_dist);
+
+  return iPoint;
+
+}
+
+void CKDTree::SearchNearest(unsigned long val_begin, unsigned long val_end, su2double *val_coord,
+                            unsigned long &val_point, su2double &val_dist) const {
+
+  unsigned long mid, iPoint;
+  unsigned short iDim;
+  su2double dist = 0.0, diff;
+
+  if (val_end <= val_begin) return;
+
+  mid = val_begin + (val_end-val_begin)/2;
+  iPoint = Index[mid];
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    dist += (Coord[iPoint*nDim+iDim]-val_coord[iDim])*(Coord[iPoint*nDim+iDim]-val_coord[iDim]);
+
+  if ((val_dist < 0.0) || (dist < val_dist) || ((dist == val_dist) && (iPoint < val_point))) {
+    val_dist = dist; val_point = iPoint;
+  }
+
+  /*--- Visit first the side of the splitting plane that contains the query,
+   the other side only if the plane is not farther than the current best ---*/
+
+  diff = val_coord[SplitDim[mid]] - Coord[iPoint*nDim+SplitDim[mid]];
+
+  if (diff < 0.0) {
+    SearchNearest(val_begin, mid, val_coord, val_point, val_dist);
+    if (diff*diff <= val_dist) SearchNearest(mid+1, val_end, val_coord, val_point, val_dist);
+  }
+  else {
+    SearchNearest(mid+1, val_end, val_coord, val_point, val_dist);
+    if (diff*diff <= val_dist) SearchNearest(val_begin, mid, val_coord, val_point, val_dist);
+  }
+
+}
+
+void CKDTree::FindRadius(su2double *val_coord, su2double val_radius, vector<unsigned long> &val_points) const {
+
+  val_points.clear();
+  SearchRadius(0, nPoint, val_coord, val_radius*val_radius, val_points);
+
+}
+
+void CKDTree::SearchRadius(unsigned long val_begin, unsigned long val_end, su2double *val_coord,
+                           su2double val_radius2, vector<unsigned long> &val_points) const {
+
+  unsigned long mid, iPoint;
+  unsigned short iDim;
+  su2double dist = 0.0, diff;
+
+  if (val_end <= val_begin) return;
+
+  mid = val_begin + (val_end-val_begin)/2;
+  iPoint = Index[mid];
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    dist += (Coord[iPoint*nDim+iDim]-val_coord[iDim])*(Coord[iPoint*nDim+iDim]-val_coord[iDim]);
+  if (dist <= val_radius2) val_points.push_back(iPoint);
+
+  diff = val_coord[SplitDim[mid]] - Coord[iPoint*nDim+SplitDim[mid]];
+
+  if ((diff <= 0.0) || (diff*diff <= val_radius2)) SearchRadius(val_begin, mid, val_coord, val_radius2, val_points);
+  if ((diff >= 0.0) || (diff*diff <= val_radius2)) SearchRadius(mid+1, val_end, val_coord, val_radius2, val_points);
+
+}
+
+void CKDTree::FindNearest(su2double *val_coord, unsigned long val_k, vector<unsigned long> &val_points,
+                          vector<su2double> &val_dist) const {
+
+  unsigned long iPoint;
+  vector<pair<su2double, unsigned long> > Heap;
+
+  val_points.clear();
+  val_dist.clear();
+  if ((nPoint == 0) || (val_k == 0)) return;
+
+  SearchKNearest(0, nPoint, val_coord, val_k, Heap);
+
+  sort_heap(Heap.begin(), Heap.end());
+  for (iPoint = 0; iPoint < Heap.size(); iPoint++) {
+    val_dist.push_back(Heap[iPoint].first);
+    val_points.push_back(Heap[iPoint].second);
+  }
+
+}
+
+void CKDTree::SearchKNearest(unsigned long val_begin, unsigned long val_end, su2double *val_coord, unsigned long val_k,
+                             vector<pair<su2double, unsigned long> > &val_heap) const {
+
+  unsigned long mid, iPoint;
+  unsigned short iDim;
+  su2double dist = 0.0, diff;
+
+  if (val_end <= val_begin) return;
+
+  mid = val_begin + (val_end-val_begin)/2;
+  iPoint = Index[mid];
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    dist += (Coord[iPoint*nDim+iDim]-val_coord[iDim])*(Coord[iPoint*nDim+iDim]-val_coord[iDim]);
+
+  /*--- The top of the heap is the farthest of the current points ---*/
+
+  if (val_heap.size() < val_k) {
+    val_heap.push_back(make_pair(dist, iPoint));
+    push_heap(val_heap.begin(), val_heap.end());
+  }
+  else if (make_pair(dist, iPoint) < val_heap.front()) {
+    pop_heap(val_heap.begin(), val_heap.end());
+    val_heap.back() = make_pair(dist, iPoint);
+    push_heap(val_heap.begin(), val_heap.end());
+  }
+
+  diff = val_coord[SplitDim[mid]] - Coord[iPoint*nDim+SplitDim[mid]];
+
+  if (diff < 0.0) {
+    SearchKNearest(val_begin, mid, val_coord, val_k, val_heap);
+    if ((val_heap.size() < val_k) || (diff*diff <= val_heap.front().first))
+      SearchKNearest(mid+1, val_end, val_coord, val_k, val_heap);
+  }
+  else {
+    SearchKNearest(mid+1, val_end, val_coord, val_k, val_heap);
+    if ((val_heap.size() < val_k) || (diff*diff <= val_heap.front().first))
+      SearchKNearest(val_begin, mid, val_coord, val_k, val_heap);
+  }
+
+}
+
 CInterpolator::CInterpolator(void){
 
 	nZone = 0;
@@ -62,10 +269,16 @@ CInterpolator::CInterpolator(void){
   Buffer_Receive_Coord=NULL;
   Buffer_Receive_Normal=NULL;
 
+  Target_BBox=NULL;
+  Donor_BBox=NULL;
+
 }
 
 CInterpolator::~CInterpolator(void){
 
+  if (Target_BBox != NULL) delete [] Target_BBox;
+  if (Donor_BBox != NULL) delete [] Donor_BBox;
+
   //if (Buffer_Receive_nVertex_Donor!=NULL) delete[] Buffer_Receive_nVertex_Donor;
 }
 
@@ -83,6 +296,10 @@ CInterpolator::CInterpolator(CGeometry ***geometry_container, CConfig **config,
 	donor_geometry  = geometry_container[donorZone][MESH_0];
 	target_geometry = geometry_container[targetZone][MESH_0];
 
+  /*--- Bounding boxes (min, max) of the interface ---*/
+  Target_BBox = new su2double[2*donor_geometry->GetnDim()];
+  Donor_BBox  = new su2double[2*donor_geometry->GetnDim()];
+
   /*--- Initialize transfer coefficients between the zones ---*/
 	/* Since this is a virtual function, call it in the child class constructor  */
   //Set_TransferCoeff(targetZone,donorZone,config);
@@ -259,6 +476,377 @@ void CInterpolator::Collect_VertexInfo(bool faces, int markDonor, int markTarget
 }
 
 
+void CInterpolator::Set_TargetBoundingBox(int markTarget, unsigned short nDim){
+  unsigned long iVertex, iPoint;
+  unsigned short iDim;
+  bool empty = true;
+
+  /*--- An empty box has its minimum above its maximum ---*/
+  for (iDim = 0; iDim < nDim; iDim++){
+    Target_BBox[iDim]      =  1E30;
+    Target_BBox[nDim+iDim] = -1E30;
+  }
+
+  if (markTarget == -1) return;
+
+  for (iVertex = 0; iVertex < target_geometry->GetnVertex(markTarget); iVertex++){
+    iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    if (target_geometry->node[iPoint]->GetDomain()){
+      for (iDim = 0; iDim < nDim; iDim++){
+        if (empty){
+          Target_BBox[iDim]      = target_geometry->node[iPoint]->GetCoord(iDim);
+          Target_BBox[nDim+iDim] = target_geometry->node[iPoint]->GetCoord(iDim);
+        }
+        else{
+          Target_BBox[iDim]      = min(Target_BBox[iDim], target_geometry->node[iPoint]->GetCoord(iDim));
+          Target_BBox[nDim+iDim] = max(Target_BBox[nDim+iDim], target_geometry->node[iPoint]->GetCoord(iDim));
+        }
+      }
+      empty = false;
+    }
+  }
+}
+
+void CInterpolator::Store_DonorElement(unsigned short nNodes, unsigned long *Nodes, su2double *Normal, unsigned short nDim){
+  unsigned short iNode, iDim;
+  unsigned long iPoint;
+  su2double Coord;
+  unsigned long nLocalElem = Local_ElemIndex.size()-1;
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  Local_BBox.resize((nLocalElem+1)*2*nDim);
+
+  for (iNode = 0; iNode < nNodes; iNode++){
+    iPoint = Nodes[iNode];
+    Local_GlobalPoint.push_back(donor_geometry->node[iPoint]->GetGlobalIndex());
+    /*--- Halo nodes are owned by the processor of their color ---*/
+    if (donor_geometry->node[iPoint]->GetDomain()) Local_Processor.push_back(rank);
+    else Local_Processor.push_back(donor_geometry->node[iPoint]->GetColor());
+    for (iDim = 0; iDim < nDim; iDim++){
+      Coord = donor_geometry->node[iPoint]->GetCoord(iDim);
+      Local_Coord.push_back(Coord);
+      if (iNode == 0){
+        Local_BBox[nLocalElem*2*nDim+iDim]      = Coord;
+        Local_BBox[nLocalElem*2*nDim+nDim+iDim] = Coord;
+      }
+      else{
+        Local_BBox[nLocalElem*2*nDim+iDim]      = min(Local_BBox[nLocalElem*2*nDim+iDim], Coord);
+        Local_BBox[nLocalElem*2*nDim+nDim+iDim] = max(Local_BBox[nLocalElem*2*nDim+nDim+iDim], Coord);
+      }
+    }
+  }
+  if (Normal != NULL){
+    for (iDim = 0; iDim < nDim; iDim++)
+      Local_Normal.push_back(Normal[iDim]);
+  }
+  Local_ElemIndex.push_back(Local_GlobalPoint.size());
+}
+
+void CInterpolator::Collect_DonorElements(bool faces, int markDonor, unsigned short nDim){
+  unsigned long iVertex, iPointDonor, jElem, nElem, donor_elem, inode, jPoint, iElem;
+  unsigned long Nodes[8];
+  unsigned short iDim, iDonor, iFace, nFaces, nNodes;
+  bool face_on_marker;
+  su2double *Normal, *Buffer_Send_BBox;
+
+  Local_ElemIndex.assign(1, 0);
+  Local_GlobalPoint.clear();
+  Local_Processor.clear();
+  Local_Coord.clear();
+  Local_Normal.clear();
+  Local_BBox.clear();
+
+  if (markDonor != -1){
+    for (iVertex = 0; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++){
+      iPointDonor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->node[iPointDonor]->GetDomain()) continue;
+
+      if (!faces){
+        Store_DonorElement(1, &iPointDonor, NULL, nDim);
+        continue;
+      }
+
+      Normal = donor_geometry->vertex[markDonor][iVertex]->GetNormal();
+
+      /*--- Faces (edges in 2D) of the marker that start at this vertex ---*/
+      if (nDim == 3){
+        nElem = donor_geometry->node[iPointDonor]->GetnElem();
+        for (jElem = 0; jElem < nElem; jElem++){
+          donor_elem = donor_geometry->node[iPointDonor]->GetElem(jElem);
+          nFaces = donor_geometry->elem[donor_elem]->GetnFaces();
+          for (iFace = 0; iFace < nFaces; iFace++){
+            face_on_marker = true;
+            nNodes = donor_geometry->elem[donor_elem]->GetnNodesFace(iFace);
+            for (iDonor = 0; iDonor < nNodes; iDonor++){
+              inode = donor_geometry->elem[donor_elem]->GetFaces(iFace, iDonor);
+              jPoint = donor_geometry->elem[donor_elem]->GetNode(inode);
+              face_on_marker = (face_on_marker && (donor_geometry->node[jPoint]->GetVertex(markDonor) != -1));
+              Nodes[iDonor] = jPoint;
+            }
+            if (face_on_marker && (Nodes[0] == iPointDonor))
+              Store_DonorElement(nNodes, Nodes, Normal, nDim);
+          }
+        }
+      }
+      else{
+        /*--- The edge is stored by the node with the lowest global index (the local order of the
+         nodes of an edge depends on the partition) ---*/
+        nElem = donor_geometry->node[iPointDonor]->GetnPoint();
+        for (jElem = 0; jElem < nElem; jElem++){
+          inode = donor_geometry->node[iPointDonor]->GetEdge(jElem);
+          jPoint = donor_geometry->edge[inode]->GetNode(0);
+          if (jPoint == iPointDonor) jPoint = donor_geometry->edge[inode]->GetNode(1);
+          face_on_marker = (donor_geometry->node[jPoint]->GetVertex(markDonor) != -1);
+          Nodes[0] = iPointDonor; Nodes[1] = jPoint;
+          if (face_on_marker && (donor_geometry->node[iPointDonor]->GetGlobalIndex() < donor_geometry->node[jPoint]->GetGlobalIndex()))
+            Store_DonorElement(2, Nodes, Normal, nDim);
+        }
+      }
+    }
+  }
+
+  /*--- Bounding box of the donor elements of all processors ---*/
+  Buffer_Send_BBox = new su2double[2*nDim];
+  for (iDim = 0; iDim < nDim; iDim++){
+    Buffer_Send_BBox[iDim]      =  1E30;
+    Buffer_Send_BBox[nDim+iDim] =  1E30;
+  }
+  for (iElem = 0; iElem < Local_ElemIndex.size()-1; iElem++){
+    for (iDim = 0; iDim < nDim; iDim++){
+      Buffer_Send_BBox[iDim]      = min(Buffer_Send_BBox[iDim], Local_BBox[iElem*2*nDim+iDim]);
+      Buffer_Send_BBox[nDim+iDim] = min(Buffer_Send_BBox[nDim+iDim], -Local_BBox[iElem*2*nDim+nDim+iDim]);
+    }
+  }
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(Buffer_Send_BBox, Donor_BBox, 2*nDim, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+#else
+  for (iDim = 0; iDim < 2*nDim; iDim++)
+    Donor_BBox[iDim] = Buffer_Send_BBox[iDim];
+#endif
+  for (iDim = 0; iDim < nDim; iDim++)
+    Donor_BBox[nDim+iDim] = -Donor_BBox[nDim+iDim];
+
+  delete [] Buffer_Send_BBox;
+}
+
+void CInterpolator::Exchange_DonorElements(bool faces, unsigned short nDim, su2double padding){
+  unsigned long iElem, jElem, iNode, nNodes, iPos, jPos;
+  unsigned short iDim;
+  int iProcessor, nSend = 0, nRecv = 0;
+  bool overlap;
+  su2double *Buffer_Send_BBox, *Buffer_Receive_BBox, *BBox;
+
+  int rank = MASTER_NODE;
+  int nProcessor = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+#endif
+
+  unsigned long nLocalElem = Local_ElemIndex.size()-1;
+  unsigned short nNormal = (faces? nDim : 0);
+
+  /*--- Padded target box and donor box of every processor ---*/
+  Buffer_Send_BBox    = new su2double[4*nDim];
+  Buffer_Receive_BBox = new su2double[4*nDim*nProcessor];
+
+  for (iDim = 0; iDim < nDim; iDim++){
+    Buffer_Send_BBox[iDim]        = Target_BBox[iDim]-padding;
+    Buffer_Send_BBox[nDim+iDim]   = Target_BBox[nDim+iDim]+padding;
+    Buffer_Send_BBox[2*nDim+iDim] =  1E30;
+    Buffer_Send_BBox[3*nDim+iDim] = -1E30;
+    if (Target_BBox[iDim] > Target_BBox[nDim+iDim]){
+      Buffer_Send_BBox[iDim]      =  1E30;
+      Buffer_Send_BBox[nDim+iDim] = -1E30;
+    }
+  }
+  for (iElem = 0; iElem < nLocalElem; iElem++){
+    for (iDim = 0; iDim < nDim; iDim++){
+      if (iElem == 0){
+        Buffer_Send_BBox[2*nDim+iDim] = Local_BBox[iDim];
+        Buffer_Send_BBox[3*nDim+iDim] = Local_BBox[nDim+iDim];
+      }
+      else{
+        Buffer_Send_BBox[2*nDim+iDim] = min(Buffer_Send_BBox[2*nDim+iDim], Local_BBox[iElem*2*nDim+iDim]);
+        Buffer_Send_BBox[3*nDim+iDim] = max(Buffer_Send_BBox[3*nDim+iDim], Local_BBox[iElem*2*nDim+nDim+iDim]);
+      }
+    }
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(Buffer_Send_BBox, 4*nDim, MPI_DOUBLE, Buffer_Receive_BBox, 4*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  for (iDim = 0; iDim < 4*nDim; iDim++)
+    Buffer_Receive_BBox[iDim] = Buffer_Send_BBox[iDim];
+#endif
+
+  /*--- Elements sent to each processor: those overlapping its padded target box. The same
+   test on the processor boxes tells every processor who it will receive from. ---*/
+  vector<bool> Send_Proc(nProcessor, false), Recv_Proc(nProcessor, false);
+  vector<vector<unsigned long> > Send_Elem(nProcessor);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    BBox = &Buffer_Receive_BBox[4*nDim*iProcessor];
+    overlap = true;
+    for (iDim = 0; iDim < nDim; iDim++){
+      overlap = (overlap && (BBox[2*nDim+iDim] <= Buffer_Send_BBox[nDim+iDim]) &&
+                 (BBox[3*nDim+iDim] >= Buffer_Send_BBox[iDim]));
+    }
+    Recv_Proc[iProcessor] = overlap;
+
+    overlap = true;
+    for (iDim = 0; iDim < nDim; iDim++){
+      overlap = (overlap && (Buffer_Send_BBox[2*nDim+iDim] <= BBox[nDim+iDim]) &&
+                 (Buffer_Send_BBox[3*nDim+iDim] >= BBox[iDim]));
+    }
+    Send_Proc[iProcessor] = overlap;
+
+    if (overlap){
+      for (iElem = 0; iElem < nLocalElem; iElem++){
+        overlap = true;
+        for (iDim = 0; iDim < nDim; iDim++){
+          overlap = (overlap && (Local_BBox[iElem*2*nDim+iDim] <= BBox[nDim+iDim]) &&
+                     (Local_BBox[iElem*2*nDim+nDim+iDim] >= BBox[iDim]));
+        }
+        if (overlap) Send_Elem[iProcessor].push_back(iElem);
+      }
+    }
+  }
+
+  /*--- Pack the elements: number of nodes, global index and owner of the nodes; coordinates
+   of the nodes and normal vector ---*/
+  vector<vector<unsigned long> > Buffer_Send_Point(nProcessor), Buffer_Receive_Point(nProcessor);
+  vector<vector<su2double> > Buffer_Send_Value(nProcessor), Buffer_Receive_Value(nProcessor);
+  vector<unsigned long> Buffer_Send_Count(2*nProcessor, 0), Buffer_Receive_Count(2*nProcessor, 0);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    for (jElem = 0; jElem < Send_Elem[iProcessor].size(); jElem++){
+      iElem = Send_Elem[iProcessor][jElem];
+      Buffer_Send_Point[iProcessor].push_back(Local_ElemIndex[iElem+1]-Local_ElemIndex[iElem]);
+      for (iNode = Local_ElemIndex[iElem]; iNode < Local_ElemIndex[iElem+1]; iNode++){
+        Buffer_Send_Point[iProcessor].push_back(Local_GlobalPoint[iNode]);
+        Buffer_Send_Point[iProcessor].push_back(Local_Processor[iNode]);
+        for (iDim = 0; iDim < nDim; iDim++)
+          Buffer_Send_Value[iProcessor].push_back(Local_Coord[iNode*nDim+iDim]);
+      }
+      for (iDim = 0; iDim < nNormal; iDim++)
+        Buffer_Send_Value[iProcessor].push_back(Local_Normal[iElem*nDim+iDim]);
+    }
+    Buffer_Send_Count[2*iProcessor]   = Buffer_Send_Point[iProcessor].size();
+    Buffer_Send_Count[2*iProcessor+1] = Buffer_Send_Value[iProcessor].size();
+  }
+
+  Buffer_Receive_Count[2*rank]   = Buffer_Send_Count[2*rank];
+  Buffer_Receive_Count[2*rank+1] = Buffer_Send_Count[2*rank+1];
+  Buffer_Receive_Point[rank]     = Buffer_Send_Point[rank];
+  Buffer_Receive_Value[rank]     = Buffer_Send_Value[rank];
+
+#ifdef HAVE_MPI
+  /*--- Point-to-point exchange with the overlapping processors only ---*/
+  MPI_Request *send_req = new MPI_Request[3*nProcessor];
+  MPI_Request *recv_req = new MPI_Request[3*nProcessor];
+  MPI_Status *send_stat = new MPI_Status[3*nProcessor];
+  MPI_Status *recv_stat = new MPI_Status[3*nProcessor];
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    if (iProcessor == rank) continue;
+    if (Recv_Proc[iProcessor]){
+      SU2_MPI::Irecv(&Buffer_Receive_Count[2*iProcessor], 2, MPI_UNSIGNED_LONG, iProcessor, 1, MPI_COMM_WORLD, &recv_req[nRecv]);
+      nRecv++;
+    }
+    if (Send_Proc[iProcessor]){
+      SU2_MPI::Isend(&Buffer_Send_Count[2*iProcessor], 2, MPI_UNSIGNED_LONG, iProcessor, 1, MPI_COMM_WORLD, &send_req[nSend]);
+      nSend++;
+    }
+  }
+  SU2_MPI::Waitall(nRecv, recv_req, recv_stat);
+  SU2_MPI::Waitall(nSend, send_req, send_stat);
+
+  nSend = 0; nRecv = 0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    if (iProcessor == rank) continue;
+    if (Recv_Proc[iProcessor] && (Buffer_Receive_Count[2*iProcessor] > 0)){
+      Buffer_Receive_Point[iProcessor].resize(Buffer_Receive_Count[2*iProcessor]);
+      Buffer_Receive_Value[iProcessor].resize(Buffer_Receive_Count[2*iProcessor+1]);
+      SU2_MPI::Irecv(&Buffer_Receive_Point[iProcessor][0], Buffer_Receive_Count[2*iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 2, MPI_COMM_WORLD, &recv_req[nRecv]);
+      SU2_MPI::Irecv(&Buffer_Receive_Value[iProcessor][0], Buffer_Receive_Count[2*iProcessor+1], MPI_DOUBLE,
+                     iProcessor, 3, MPI_COMM_WORLD, &recv_req[nRecv+1]);
+      nRecv += 2;
+    }
+    if (Send_Proc[iProcessor] && (Buffer_Send_Count[2*iProcessor] > 0)){
+      SU2_MPI::Isend(&Buffer_Send_Point[iProcessor][0], Buffer_Send_Count[2*iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 2, MPI_COMM_WORLD, &send_req[nSend]);
+      SU2_MPI::Isend(&Buffer_Send_Value[iProcessor][0], Buffer_Send_Count[2*iProcessor+1], MPI_DOUBLE,
+                     iProcessor, 3, MPI_COMM_WORLD, &send_req[nSend+1]);
+      nSend += 2;
+    }
+  }
+  SU2_MPI::Waitall(nRecv, recv_req, recv_stat);
+  SU2_MPI::Waitall(nSend, send_req, send_stat);
+
+  delete [] send_req;
+  delete [] recv_req;
+  delete [] send_stat;
+  delete [] recv_stat;
+#endif
+
+  /*--- Unpack the received elements, ordered by sending processor ---*/
+  Donor_ElemIndex.assign(1, 0);
+  Donor_GlobalPoint.clear();
+  Donor_Processor.clear();
+  Donor_Coord.clear();
+  Donor_Normal.clear();
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    iPos = 0; jPos = 0;
+    while (iPos < Buffer_Receive_Point[iProcessor].size()){
+      nNodes = Buffer_Receive_Point[iProcessor][iPos]; iPos++;
+      for (iNode = 0; iNode < nNodes; iNode++){
+        Donor_GlobalPoint.push_back(Buffer_Receive_Point[iProcessor][iPos]);
+        Donor_Processor.push_back((int)Buffer_Receive_Point[iProcessor][iPos+1]);
+        iPos += 2;
+        for (iDim = 0; iDim < nDim; iDim++){
+          Donor_Coord.push_back(Buffer_Receive_Value[iProcessor][jPos]); jPos++;
+        }
+      }
+      for (iDim = 0; iDim < nNormal; iDim++){
+        Donor_Normal.push_back(Buffer_Receive_Value[iProcessor][jPos]); jPos++;
+      }
+      Donor_ElemIndex.push_back(Donor_GlobalPoint.size());
+    }
+  }
+
+  delete [] Buffer_Send_BBox;
+  delete [] Buffer_Receive_BBox;
+}
+
+bool CInterpolator::Check_BoundingBox(su2double *coord, su2double dist, su2double padding, unsigned short nDim){
+  unsigned short iDim;
+  bool inside = true;
+
+  for (iDim = 0; iDim < nDim; iDim++){
+    inside = (inside && (coord[iDim]-dist >= Target_BBox[iDim]-padding) &&
+              (coord[iDim]+dist <= Target_BBox[nDim+iDim]+padding));
+  }
+  return inside;
+}
+
+su2double CInterpolator::Get_CoverPadding(unsigned short nDim){
+  unsigned short iDim;
+  su2double padding = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++){
+    padding = max(padding, Target_BBox[iDim]-Donor_BBox[iDim]);
+    padding = max(padding, Donor_BBox[nDim+iDim]-Target_BBox[nDim+iDim]);
+  }
+  return padding;
+}
+
 /* Nearest Neighbor Interpolator */
 CNearestNeighbor::CNearestNeighbor(void):  CInterpolator(){ }
 
@@ -273,7 +861,6 @@ CNearestNeighbor::~CNearestNeighbor(){}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config){
 
-  unsigned long jVertex;
   unsigned short iDim;
   unsigned short nDim = donor_geometry->GetnDim();
 
@@ -284,30 +871,20 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config){
   unsigned long nVertexDonor = 0, nVertexTarget= 0;
   unsigned long Point_Target = 0;
 
-  unsigned long iVertexTarget;
+  unsigned long iVertexTarget, nDonorElem, iElem;
   unsigned long pGlobalPoint = 0;
-  int iProcessor, pProcessor = 0;
+  int pProcessor = 0;
 
   unsigned short int iDonor = 0;
-  unsigned long Global_Point_Donor;
+  unsigned short Search_Fail, Search_Fail_Global;
+
+  su2double *Coord_i, dist = 0.0, mindist, padding, cover_padding, fail_padding, diag;
 
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt     = (config[donorZone]->GetMarker_n_FSIinterface())/2;
   nMarkerTarget  = target_geometry->GetnMarker();
   nMarkerDonor   = donor_geometry->GetnMarker();
 
-  su2double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist;
-
-  int nProcessor = SINGLE_NODE;
-
-#ifdef HAVE_MPI
-  int rank = MASTER_NODE;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-#endif
-
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
-
   // For the markers on the interface
   for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
 
@@ -349,72 +926,92 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config){
 		  }
 	  }
 
-	  Buffer_Send_nVertex_Donor = new unsigned long [1];
-    Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
+    /*--- Bounding box of the local target vertices and local donor vertices ---*/
+    Set_TargetBoundingBox(markTarget, nDim);
+    Collect_DonorElements(false, markDonor, nDim);
+
+    /*--- Initial padding of the target box: a tenth of its size plus a
+     thousandth of the size of the donor interface ---*/
+    padding = 0.0;
+    if (Target_BBox[0] <= Target_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Target_BBox[nDim+iDim]-Target_BBox[iDim], 2.0);
+      padding += 0.1*sqrt(diag);
+    }
+    if (Donor_BBox[0] <= Donor_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Donor_BBox[nDim+iDim]-Donor_BBox[iDim], 2.0);
+      padding += 0.001*sqrt(diag);
+    }
+
+    vector<unsigned long> Target_Donor(nVertexTarget, 0);
+
+    /*--- Receive the donors inside the padded target box and search them with a k-d tree.
+     The nearest donor is exact when the ball through it fits in the padded box, otherwise
+     the padding is enlarged and the search repeated ---*/
+    do {
 
-	  /* Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor */
-	  Determine_ArraySize(false, markDonor,markTarget,nVertexDonor,nDim);
+      Exchange_DonorElements(false, nDim, padding);
 
-    Buffer_Send_Coord = new su2double [MaxLocalVertex_Donor*nDim];
-    Buffer_Send_GlobalPoint = new unsigned long [MaxLocalVertex_Donor];
+      nDonorElem = Donor_ElemIndex.size()-1;
+      CKDTree DonorTree(nDonorElem, nDim, (nDonorElem > 0)? &Donor_Coord[0] : NULL);
 
-    Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalVertex_Donor*nDim];
-    Buffer_Receive_GlobalPoint = new unsigned long [nProcessor*MaxLocalVertex_Donor];
+      cover_padding = Get_CoverPadding(nDim);
+      fail_padding  = 0.0;
+      Search_Fail   = 0;
 
-	  /*-- Colllect coordinates, global points, and normal vectors ---*/
-	  Collect_VertexInfo(false, markDonor,markTarget,nVertexDonor,nDim);
+      for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
 
-	  /*--- Compute the closest point to a Near-Field boundary point ---*/
-	  maxdist = 0.0;
-	  for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+        Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+        if (!target_geometry->node[Point_Target]->GetDomain()) continue;
 
-		  Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+        Coord_i = target_geometry->node[Point_Target]->GetCoord();
 
-		  if (target_geometry->node[Point_Target]->GetDomain()) {
+        if (nDonorElem == 0){
+          if (padding < cover_padding){ Search_Fail = 1; fail_padding = cover_padding; }
+          continue;
+        }
 
-			  target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
-			  target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo();
+        iElem = DonorTree.FindNearest(Coord_i, mindist);
+        Target_Donor[iVertexTarget] = iElem;
 
-			  /*--- Coordinates of the boundary point ---*/
-			  Coord_i = target_geometry->node[Point_Target]->GetCoord();
-			  mindist = 1E6; pProcessor = 0;
+        dist = sqrt(mindist);
+        if ((padding < cover_padding) && !Check_BoundingBox(Coord_i, dist, padding, nDim)){
+          Search_Fail = 1; fail_padding = max(fail_padding, min(dist, cover_padding));
+        }
+      }
 
-			  /*--- Loop over all the boundaries to find the pair ---*/
-			  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
-				  for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-					  Global_Point_Donor = Buffer_Receive_GlobalPoint[iProcessor*MaxLocalVertex_Donor+jVertex];
+#ifdef HAVE_MPI
+      SU2_MPI::Allreduce(&Search_Fail, &Search_Fail_Global, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#else
+      Search_Fail_Global = Search_Fail;
+#endif
 
-					  /*--- Compute the dist ---*/
-					  dist = 0.0; for (iDim = 0; iDim < nDim; iDim++) {
-						  Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Donor+jVertex)*nDim+iDim];
-						  dist += pow(Coord_j[iDim]-Coord_i[iDim],2.0);
-					  }
+      padding = max(2.0*padding, fail_padding);
 
-					  if (dist < mindist) {
-						  mindist = dist; pProcessor = iProcessor; pGlobalPoint = Global_Point_Donor;
-					  }
+    } while (Search_Fail_Global != 0);
 
-					  if (dist == 0.0) break;
-				  }
-			  }
+    /*--- Store the value of the pair ---*/
+    for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
 
-			  /*--- Store the value of the pair ---*/
-			  maxdist = max(maxdist, mindist);
-			  target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
-			  target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
-			  target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor,1.0);
-	      //cout <<" Nearest Neighbor for target g.i " << target_geometry->node[Point_Target]->GetGlobalIndex() <<" is "<< pGlobalPoint << "; d = " << mindist<< endl;
-		  }
-	  }
+      Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
 
-	  delete[] Buffer_Send_Coord;
-	  delete[] Buffer_Send_GlobalPoint;
+      if (target_geometry->node[Point_Target]->GetDomain()) {
 
-	  delete[] Buffer_Receive_Coord;
-	  delete[] Buffer_Receive_GlobalPoint;
+        pGlobalPoint = 0; pProcessor = 0;
+        if (Donor_ElemIndex.size() > 1){
+          iElem = Target_Donor[iVertexTarget];
+          pGlobalPoint = Donor_GlobalPoint[iElem];
+          pProcessor   = Donor_Processor[iElem];
+        }
 
-	  delete[] Buffer_Send_nVertex_Donor;
-	  delete[] Buffer_Receive_nVertex_Donor;
+        target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
+        target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo();
+        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
+        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
+        target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor,1.0);
+      }
+    }
 
   }
 
@@ -434,9 +1031,8 @@ CIsoparametric::CIsoparametric(CGeometry ***geometry_container, CConfig **config
 CIsoparametric::~CIsoparametric(){}
 
 void CIsoparametric::Set_TransferCoeff(CConfig **config){
-  unsigned long iVertex, jVertex;
-  unsigned long  dPoint, inode, jElem, nElem;
-  unsigned short iDim, iDonor=0, iFace;
+  unsigned long iVertex, iElem, jElem, kElem, nDonorElem, iNode;
+  unsigned short iDim, iDonor=0;
 
   unsigned short nDim = donor_geometry->GetnDim();
 
@@ -445,41 +1041,17 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config){
 
   int markDonor=0, markTarget=0;
 
-  long donor_elem=0, temp_donor=0;
   unsigned int nNodes=0;
-  /*--- Restricted to 2-zone for now ---*/
-  unsigned int nFaces=1; //For 2D cases, we want to look at edges, not faces, as the 'interface'
-  bool face_on_marker=true;
 
   unsigned long nVertexDonor = 0, nVertexTarget= 0;
   unsigned long Point_Target = 0;
 
-  unsigned long iVertexDonor, iPointDonor = 0;
-  unsigned long jGlobalPoint = 0;
-  int iProcessor;
-
-  unsigned long nLocalFace_Donor = 0, nLocalFaceNodes_Donor=0;
-
-  unsigned long faceindex;
+  unsigned short Search_Fail, Search_Fail_Global;
 
-  su2double dist = 0.0, mindist=1E6, *Coord, *Coord_i;
+  su2double dist = 0.0, mindist, *Coord_i, radius, maxradius, padding, cover_padding, fail_padding, diag;
   su2double myCoeff[10]; // Maximum # of donor points
-  su2double  *Normal;
-  su2double *projected_point = new su2double[nDim];
-  su2double tmp, tmp2;
-  su2double storeCoeff[10];
-  unsigned long storeGlobal[10];
-  int storeProc[10];
-
-  int rank = MASTER_NODE;
-  int nProcessor = SINGLE_NODE;
-  Coord = new su2double[nDim];
-  Normal = new su2double[nDim];
 
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-#endif
+  vector<unsigned long> Candidates;
 
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt     = (config[donorZone]->GetMarker_n_FSIinterface())/2;
@@ -532,272 +1104,177 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config){
       }
     }
 
-    Buffer_Send_nVertex_Donor = new unsigned long [1];
-    Buffer_Send_nFace_Donor= new unsigned long [1];
-    Buffer_Send_nFaceNodes_Donor= new unsigned long [1];
-
-    Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
-    Buffer_Receive_nFace_Donor = new unsigned long [nProcessor];
-    Buffer_Receive_nFaceNodes_Donor = new unsigned long [nProcessor];
+    /*--- Bounding box of the local target vertices and local donor faces ---*/
+    Set_TargetBoundingBox(markTarget, nDim);
+    Collect_DonorElements(true, markDonor, nDim);
+
+    /*--- Initial padding of the target box: a tenth of its size plus a
+     thousandth of the size of the donor interface ---*/
+    padding = 0.0;
+    if (Target_BBox[0] <= Target_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Target_BBox[nDim+iDim]-Target_BBox[iDim], 2.0);
+      padding += 0.1*sqrt(diag);
+    }
+    if (Donor_BBox[0] <= Donor_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Donor_BBox[nDim+iDim]-Donor_BBox[iDim], 2.0);
+      padding += 0.001*sqrt(diag);
+    }
 
-    /* Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor */
-    Determine_ArraySize(true, markDonor,markTarget,nVertexDonor,nDim);
+    vector<unsigned long> Target_Donor(nVertexTarget, 0);
+
+    /*--- Receive the faces that overlap the padded target box. The closest face is searched
+     among those whose centroid is within the distance to the face of the nearest centroid plus
+     the largest face radius. The padding is enlarged until the ball through the interpolated
+     point of every target vertex fits in the padded box ---*/
+    do {
+
+      Exchange_DonorElements(true, nDim, padding);
+
+      nDonorElem = Donor_ElemIndex.size()-1;
+
+      vector<su2double> Centroid(nDonorElem*nDim, 0.0);
+      maxradius = 0.0;
+      for (iElem = 0; iElem < nDonorElem; iElem++){
+        nNodes = Donor_ElemIndex[iElem+1]-Donor_ElemIndex[iElem];
+        for (iNode = Donor_ElemIndex[iElem]; iNode < Donor_ElemIndex[iElem+1]; iNode++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Centroid[iElem*nDim+iDim] += Donor_Coord[iNode*nDim+iDim]/su2double(nNodes);
+        for (iNode = Donor_ElemIndex[iElem]; iNode < Donor_ElemIndex[iElem+1]; iNode++){
+          radius = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            radius += pow(Donor_Coord[iNode*nDim+iDim]-Centroid[iElem*nDim+iDim], 2.0);
+          maxradius = max(maxradius, sqrt(radius));
+        }
+      }
+      CKDTree FaceTree(nDonorElem, nDim, (nDonorElem > 0)? &Centroid[0] : NULL);
 
-    Buffer_Send_Coord = new su2double [MaxLocalVertex_Donor*nDim];
-    Buffer_Send_Normal = new su2double [MaxLocalVertex_Donor*nDim];
-    Buffer_Send_GlobalPoint = new unsigned long [MaxLocalVertex_Donor];
+      cover_padding = Get_CoverPadding(nDim);
+      fail_padding  = 0.0;
+      Search_Fail   = 0;
 
-    Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalVertex_Donor*nDim];
-    Buffer_Receive_Normal = new su2double [nProcessor*MaxLocalVertex_Donor*nDim];
-    Buffer_Receive_GlobalPoint = new unsigned long [nProcessor*MaxLocalVertex_Donor];
+      /*--- Loop over the vertices on the target Marker ---*/
+      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
 
-    /*-- Colllect coordinates, global points, and normal vectors ---*/
-    Collect_VertexInfo(true, markDonor,markTarget,nVertexDonor,nDim);
+        Point_Target = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->node[Point_Target]->GetDomain()) continue;
 
-    Buffer_Send_FaceIndex   = new unsigned long[MaxFace_Donor];
-    Buffer_Send_FaceNodes   = new unsigned long[MaxFaceNodes_Donor];
-    Buffer_Send_FaceProc    = new unsigned long[MaxFaceNodes_Donor];
+        Coord_i = target_geometry->node[Point_Target]->GetCoord();
 
-    Buffer_Receive_FaceIndex= new unsigned long[MaxFace_Donor*nProcessor];
-    Buffer_Receive_FaceNodes= new unsigned long[MaxFaceNodes_Donor*nProcessor];
-    Buffer_Receive_FaceProc = new unsigned long[MaxFaceNodes_Donor*nProcessor];
+        if (nDonorElem == 0){
+          if (padding < cover_padding){ Search_Fail = 1; fail_padding = cover_padding; }
+          continue;
+        }
 
-    nLocalFace_Donor=0;
-    nLocalFaceNodes_Donor=0;
+        jElem = FaceTree.FindNearest(Coord_i, dist);
+        mindist = Face_Distance(jElem, nDim, Coord_i, myCoeff);
 
-    /*--- Collect Face info ---*/
-    for (iVertex=0; iVertex<MaxFace_Donor; iVertex++){
-      Buffer_Send_FaceIndex[iVertex]=0;
-    }
-    for (iVertex=0; iVertex<MaxFaceNodes_Donor; iVertex++){
-      Buffer_Send_FaceNodes[iVertex]=0;
-      Buffer_Send_FaceProc[iVertex]=0;
-    }
+        FaceTree.FindRadius(Coord_i, sqrt(mindist)+maxradius, Candidates);
+        for (kElem = 0; kElem < Candidates.size(); kElem++){
+          iElem = Candidates[kElem];
+          dist = Face_Distance(iElem, nDim, Coord_i, myCoeff);
+          /*--- If the dist is shorter than last closest, update ---*/
+          if ((dist < mindist) || ((dist == mindist) && (iElem < jElem))){
+            mindist = dist; jElem = iElem;
+          }
+        }
+        Target_Donor[iVertex] = jElem;
 
-    Buffer_Send_FaceIndex[0]=rank*MaxFaceNodes_Donor;
-
-    if (nDim==2) nNodes=2;
-
-    for (iVertexDonor = 0; iVertexDonor < nVertexDonor; iVertexDonor++) {
-      iPointDonor = donor_geometry->vertex[markDonor][iVertexDonor]->GetNode();
-
-      if (donor_geometry->node[iPointDonor]->GetDomain()) {
-
-        if (nDim==3)  nElem = donor_geometry->node[iPointDonor]->GetnElem();
-        else          nElem =donor_geometry->node[iPointDonor]->GetnPoint();
-
-        for (jElem=0; jElem < nElem; jElem++){
-          if (nDim==3){
-            temp_donor = donor_geometry->node[iPointDonor]->GetElem(jElem);
-            nFaces = donor_geometry->elem[temp_donor]->GetnFaces();
-            for (iFace=0; iFace<nFaces; iFace++){
-              /*-- Determine whether this face/edge is on the marker --*/
-              face_on_marker=true;
-              nNodes = donor_geometry->elem[temp_donor]->GetnNodesFace(iFace);
-              for (iDonor=0; iDonor<nNodes; iDonor++){
-                inode = donor_geometry->elem[temp_donor]->GetFaces(iFace, iDonor);
-                dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
-                face_on_marker = (face_on_marker && (donor_geometry->node[dPoint]->GetVertex(markDonor) !=-1));
-              }
-
-              if (face_on_marker ){
-                for (iDonor=0; iDonor<nNodes; iDonor++){
-                  inode = donor_geometry->elem[temp_donor]->GetFaces(iFace, iDonor);
-                  dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
-                  // Match node on the face to the correct global index
-                  jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-                  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
-                    for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                      if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]){
-                        Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                        Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                      }
-                    }
-                  }
-                  nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
-                }
-                /* Store the indices */
-                Buffer_Send_FaceIndex[nLocalFace_Donor+1] = Buffer_Send_FaceIndex[nLocalFace_Donor]+nNodes;
-                nLocalFace_Donor++; // Increment number of faces / processor
-              }
-            }
-          }
-          else{
-            /*-- Determine whether this face/edge is on the marker --*/
-            face_on_marker=true;
-            for (iDonor=0; iDonor<nNodes; iDonor++){
-              inode = donor_geometry->node[iPointDonor]->GetEdge(jElem);
-              dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
-              face_on_marker = (face_on_marker && (donor_geometry->node[dPoint]->GetVertex(markDonor) !=-1));
-            }
-            if (face_on_marker ){
-              for (iDonor=0; iDonor<nNodes; iDonor++){
-                inode = donor_geometry->node[iPointDonor]->GetEdge(jElem);
-                dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
-                // Match node on the face to the correct global index
-                jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-                for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
-                  for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                    if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]){
-                      Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                      Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                    }
-                  }
-                }
-                nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
-              }
-              /* Store the indices */
-              Buffer_Send_FaceIndex[nLocalFace_Donor+1] = Buffer_Send_FaceIndex[nLocalFace_Donor]+nNodes;
-              nLocalFace_Donor++; // Increment number of faces / processor
-            }
-          }
+        dist = sqrt(mindist);
+        if ((padding < cover_padding) && !Check_BoundingBox(Coord_i, dist, padding, nDim)){
+          Search_Fail = 1; fail_padding = max(fail_padding, min(dist, cover_padding));
         }
       }
-    }
 
-    //Buffer_Send_FaceIndex[nLocalFace_Donor+1] = MaxFaceNodes_Donor*rank+nLocalFaceNodes_Donor;
 #ifdef HAVE_MPI
-    SU2_MPI::Allgather(Buffer_Send_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_FaceProc, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceProc, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&Search_Fail, &Search_Fail_Global, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
 #else
-    for (iFace=0; iFace<MaxFace_Donor; iFace++){
-      Buffer_Receive_FaceIndex[iFace] = Buffer_Send_FaceIndex[iFace];
-    }
-    for (iVertex = 0; iVertex < MaxFaceNodes_Donor; iVertex++)
-      Buffer_Receive_FaceNodes[iVertex] = Buffer_Send_FaceNodes[iVertex];
-    for (iVertex = 0; iVertex < MaxFaceNodes_Donor; iVertex++)
-      Buffer_Receive_FaceProc[iVertex] = Buffer_Send_FaceProc[iVertex];
+      Search_Fail_Global = Search_Fail;
 #endif
 
-    /*--- Loop over the vertices on the target Marker ---*/
-    for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
-      mindist=1E6;
-      for (unsigned short iCoeff=0; iCoeff<10; iCoeff++){
-        storeCoeff[iCoeff]=0;
-      }
-      Point_Target = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      padding = max(2.0*padding, fail_padding);
 
-      if (target_geometry->node[Point_Target]->GetDomain()) {
+    } while (Search_Fail_Global != 0);
 
-        Coord_i = target_geometry->node[Point_Target]->GetCoord();
-        /*---Loop over the faces previously communicated/stored ---*/
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+    /*--- Set the appropriate amount of memory and fill ---*/
+    for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
 
-          nFaces = (unsigned int)Buffer_Receive_nFace_Donor[iProcessor];
-
-          for (iFace = 0; iFace< nFaces; iFace++){
-            /*--- ---*/
-
-            nNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] -
-                    (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace];
-
-            su2double *X = new su2double[nNodes*nDim];
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            for (iDonor=0; iDonor<nNodes; iDonor++){
-              jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
-              for (iDim=0; iDim<nDim; iDim++){
-                X[iDim*nNodes+iDonor]=
-                    Buffer_Receive_Coord[jVertex*nDim+iDim];
-              }
-            }
-            jVertex = Buffer_Receive_FaceNodes[faceindex];
+      Point_Target = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->node[Point_Target]->GetDomain()) continue;
 
-            for (iDim=0; iDim<nDim; iDim++){
-              Normal[iDim] = Buffer_Receive_Normal[jVertex*nDim+iDim];
-            }
+      if (Donor_ElemIndex.size() == 1){
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(0);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+        continue;
+      }
 
-            /* Project point used for case where surfaces are not exactly coincident, where
-             * the point is assumed connected by a rigid rod normal to the surface.
-             */
-            tmp = 0;
-            tmp2=0;
-            for (iDim=0; iDim<nDim; iDim++){
-              tmp+=Normal[iDim]*Normal[iDim];
-              tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
-            }
-            tmp = 1/tmp;
-            tmp2 = tmp2*sqrt(tmp);
-            for (iDim=0; iDim<nDim; iDim++){
-              // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
-              // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
-              // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
-              // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
-              projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
-            }
+      Coord_i = target_geometry->node[Point_Target]->GetCoord();
+      jElem   = Target_Donor[iVertex];
+      Face_Distance(jElem, nDim, Coord_i, myCoeff);
 
-            Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
+      nNodes = Donor_ElemIndex[jElem+1]-Donor_ElemIndex[jElem];
+      target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
+      target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
-            /*--- Find distance to the interpolated point ---*/
-            dist = 0.0;
-            for (iDim=0; iDim<nDim; iDim++){
-              Coord[iDim] = Coord_i[iDim];
-              for(iDonor=0; iDonor< nNodes; iDonor++){
-                Coord[iDim]-=myCoeff[iDonor]*X[iDim*nNodes+iDonor];
-              }
-              dist+=pow(Coord[iDim],2.0);
-            }
-
-            /*--- If the dist is shorter than last closest (and nonzero nodes are on the boundary), update ---*/
-            if (dist<mindist ){
-              /*--- update last dist ---*/
-              mindist = dist;
-              /*--- Store info ---*/
-              donor_elem = temp_donor;
-              target_geometry->vertex[markTarget][iVertex]->SetDonorElem(donor_elem); // in 2D is nearest neighbor
-              target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
-              for (iDonor=0; iDonor<nNodes; iDonor++){
-                storeCoeff[iDonor] = myCoeff[iDonor];
-                jVertex = Buffer_Receive_FaceNodes[faceindex+iDonor];
-                storeGlobal[iDonor] =Buffer_Receive_GlobalPoint[jVertex];
-                storeProc[iDonor] = (int)Buffer_Receive_FaceProc[faceindex+iDonor];
-              }
-            }
-          
-            delete [] X;
-          }
-        }
-        /*--- Set the appropriate amount of memory and fill ---*/
-        nNodes =target_geometry->vertex[markTarget][iVertex]->GetnDonorPoints();
-        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
-
-        for (iDonor=0; iDonor<nNodes; iDonor++){
-          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,storeGlobal[iDonor]);
-          //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;
-          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,storeCoeff[iDonor]);
-          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
-        }
+      for (iDonor=0; iDonor<nNodes; iDonor++){
+        iNode = Donor_ElemIndex[jElem]+iDonor;
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor, Donor_GlobalPoint[iNode]);
+        target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor, myCoeff[iDonor]);
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, Donor_Processor[iNode]);
       }
     }
+  }
 
-    delete[] Buffer_Send_nVertex_Donor;
-    delete[] Buffer_Send_nFace_Donor;
-    delete[] Buffer_Send_nFaceNodes_Donor;
-
-    delete[] Buffer_Receive_nVertex_Donor;
-    delete[] Buffer_Receive_nFace_Donor;
-    delete[] Buffer_Receive_nFaceNodes_Donor;
-
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_Normal;
-    delete[] Buffer_Send_GlobalPoint;
+}
 
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_Normal;
-    delete[] Buffer_Receive_GlobalPoint;
+su2double CIsoparametric::Face_Distance(unsigned long iElem, unsigned short nDim, su2double *Coord_i, su2double *myCoeff){
+  unsigned short iDim, iDonor, nNodes;
+  unsigned long iNode;
+  su2double X[30], Coord[3], projected_point[3], *Normal;
+  su2double tmp, tmp2, dist;
+
+  nNodes = Donor_ElemIndex[iElem+1]-Donor_ElemIndex[iElem];
+  for (iDonor=0; iDonor<nNodes; iDonor++){
+    iNode = Donor_ElemIndex[iElem]+iDonor;
+    for (iDim=0; iDim<nDim; iDim++){
+      X[iDim*nNodes+iDonor] = Donor_Coord[iNode*nDim+iDim];
+    }
+  }
+  Normal = &Donor_Normal[iElem*nDim];
+
+  /* Project point used for case where surfaces are not exactly coincident, where
+   * the point is assumed connected by a rigid rod normal to the surface.
+   */
+  tmp = 0;
+  tmp2=0;
+  for (iDim=0; iDim<nDim; iDim++){
+    tmp+=Normal[iDim]*Normal[iDim];
+    tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
+  }
+  tmp = 1/tmp;
+  tmp2 = tmp2*sqrt(tmp);
+  for (iDim=0; iDim<nDim; iDim++){
+    // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
+    // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
+    // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
+    // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
+    projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
+  }
 
-    delete[] Buffer_Send_FaceIndex;
-    delete[] Buffer_Send_FaceNodes;
-    delete[] Buffer_Send_FaceProc;
+  Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
 
-    delete[] Buffer_Receive_FaceIndex;
-    delete[] Buffer_Receive_FaceNodes;
-    delete[] Buffer_Receive_FaceProc;
+  /*--- Find distance to the interpolated point ---*/
+  dist = 0.0;
+  for (iDim=0; iDim<nDim; iDim++){
+    Coord[iDim] = Coord_i[iDim];
+    for(iDonor=0; iDonor< nNodes; iDonor++){
+      Coord[iDim]-=myCoeff[iDonor]*X[iDim*nNodes+iDonor];
+    }
+    dist+=pow(Coord[iDim],2.0);
   }
-  delete [] Coord;
-  delete [] Normal;
-  
-  delete [] projected_point;
+
+  return dist;
 }
 
 void CIsoparametric::Isoparameters(unsigned short nDim, unsigned short nDonor,
@@ -807,9 +1284,9 @@ void CIsoparametric::Isoparameters(unsigned short nDim, unsigned short nDonor,
   
   su2double *x     = new su2double[nDim+1];
   su2double *x_tmp = new su2double[nDim+1];
-  su2double *Q     = new su2double[nDonor*nDonor];
+  su2double *Q     = new su2double[(nDim+1+nDonor)*nDonor];
   su2double *R     = new su2double[nDonor*nDonor];
-  su2double *A     = new su2double[nDim+1*nDonor];
+  su2double *A     = new su2double[(nDim+1)*nDonor];
   su2double *A2    = NULL;
   su2double *x2    = new su2double[nDim+1];
   
@@ -826,7 +1303,7 @@ void CIsoparametric::Isoparameters(unsigned short nDim, unsigned short nDonor,
     for (iDonor=0; iDonor<nDonor; iDonor++){
       isoparams[iDonor]=0;
       A[iDonor]=1.0;
-      for (iDim=0; iDim<n; iDim++)
+      for (iDim=0; iDim<nDim; iDim++)
         A[(iDim+1)*nDonor+iDonor]=X[iDim*nDonor+iDonor];
     }
 
@@ -875,10 +1352,10 @@ void CIsoparametric::Isoparameters(unsigned short nDim, unsigned short nDonor,
       }
     }
     /*--- Initialize Q,R to 0 --*/
-    for (k=0; k<nDonor*nDonor; k++){
+    for (k=0; k<(nDim+1+nDonor)*nDonor; k++)
       Q[k]=0;
+    for (k=0; k<nDonor*nDonor; k++)
       R[k]=0;
-    }
     /*--- TODO: make this loop more efficient ---*/
     /*--- Solve for rectangular Q1 R1 ---*/
     for (iDonor=0; iDonor<nDonor; iDonor++){
@@ -993,6 +1470,832 @@ void CIsoparametric::Isoparameters(unsigned short nDim, unsigned short nDonor,
 }
 
 
+/* Radial Basis Function Interpolator */
+CRadialBasisFunction::CRadialBasisFunction(CGeometry ***geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone) :  CInterpolator(geometry_container, config, iZone, jZone){
+
+  /*--- Initialize transfer coefficients between the zones ---*/
+  Set_TransferCoeff(config);
+
+}
+
+CRadialBasisFunction::~CRadialBasisFunction(){}
+
+void CRadialBasisFunction::Set_TransferCoeff(CConfig **config){
+
+  unsigned short iDim, iDonor, nDonor;
+  unsigned short nDim = donor_geometry->GetnDim();
+  unsigned short Kind_RBF = config[donorZone]->GetInterpolation_RBF_Function();
+  unsigned short nNear = config[donorZone]->GetInterpolation_RBF_Points();
+
+  unsigned short nMarkerInt, nMarkerDonor, nMarkerTarget;
+  unsigned short iMarkerInt, iMarkerDonor, iMarkerTarget;
+  int markDonor = -1, markTarget = -1;
+
+  unsigned long nVertexDonor = 0, nVertexTarget= 0;
+  unsigned long Point_Target = 0;
+
+  unsigned long iVertexTarget, nDonorElem, iElem;
+
+  unsigned short Search_Fail, Search_Fail_Global;
+
+  su2double *Coord_i, dist = 0.0, padding, cover_padding, fail_padding, diag;
+
+  vector<unsigned long> Near_Points;
+  vector<su2double> Near_Dist;
+
+  /*--- Default number of donor points of each target point ---*/
+  if (nNear == 0) nNear = (nDim == 2)? 4 : 12;
+
+  vector<su2double> X(nNear*nDim), myCoeff(nNear);
+
+  /*--- Number of markers on the FSI interface ---*/
+  nMarkerInt     = (config[donorZone]->GetMarker_n_FSIinterface())/2;
+  nMarkerTarget  = target_geometry->GetnMarker();
+  nMarkerDonor   = donor_geometry->GetnMarker();
+
+  // For the markers on the interface
+  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+
+    markDonor = -1;
+    markTarget = -1;
+
+    /*--- On the donor side ---*/
+
+    for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
+      /*--- If the tag GetMarker_All_FSIinterface(iMarkerDonor) equals the index we are looping at ---*/
+      if (config[donorZone]->GetMarker_All_FSIinterface(iMarkerDonor) == iMarkerInt ){
+        /*--- We have identified the identifier for the structural marker ---*/
+        markDonor = iMarkerDonor;
+        /*--- Store the number of local points that belong to markDonor ---*/
+        nVertexDonor = donor_geometry->GetnVertex(iMarkerDonor);
+        break;
+      }
+      else {
+        /*--- If the tag hasn't matched any tag within the donor markers ---*/
+        markDonor = -1;
+        nVertexDonor = 0;
+      }
+    }
+
+    /*--- On the target side ---*/
+    for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
+      /*--- If the tag GetMarker_All_FSIinterface(iMarkerFlow) equals the index we are looping at ---*/
+      if (config[targetZone]->GetMarker_All_FSIinterface(iMarkerTarget) == iMarkerInt ){
+        /*--- We have identified the identifier for the target marker ---*/
+        markTarget = iMarkerTarget;
+        /*--- Store the number of local points that belong to markTarget ---*/
+        nVertexTarget = target_geometry->GetnVertex(iMarkerTarget);
+        break;
+      }
+      else {
+        /*--- If the tag hasn't matched any tag within the Flow markers ---*/
+        nVertexTarget = 0;
+        markTarget = -1;
+      }
+    }
+
+    /*--- Bounding box of the local target vertices and local donor vertices ---*/
+    Set_TargetBoundingBox(markTarget, nDim);
+    Collect_DonorElements(false, markDonor, nDim);
+
+    /*--- Initial padding of the target box: a tenth of its size plus a
+     thousandth of the size of the donor interface ---*/
+    padding = 0.0;
+    if (Target_BBox[0] <= Target_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Target_BBox[nDim+iDim]-Target_BBox[iDim], 2.0);
+      padding += 0.1*sqrt(diag);
+    }
+    if (Donor_BBox[0] <= Donor_BBox[nDim]){
+      diag = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) diag += pow(Donor_BBox[nDim+iDim]-Donor_BBox[iDim], 2.0);
+      padding += 0.001*sqrt(diag);
+    }
+
+    vector<unsigned long> Target_Donor(nVertexTarget*nNear, 0);
+    vector<unsigned short> Target_nDonor(nVertexTarget, 0);
+
+    /*--- Receive the donors inside the padded target box and search the nNear closest
+     with a k-d tree. They are exact when the ball through the farthest of them fits
+     in the padded box (or when all the donors have been received) ---*/
+    do {
+
+      Exchange_DonorElements(false, nDim, padding);
+
+      nDonorElem = Donor_ElemIndex.size()-1;
+      CKDTree DonorTree(nDonorElem, nDim, (nDonorElem > 0)? &Donor_Coord[0] : NULL);
+
+      cover_padding = Get_CoverPadding(nDim);
+      fail_padding  = 0.0;
+      Search_Fail   = 0;
+
+      for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+
+        Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+        if (!target_geometry->node[Point_Target]->GetDomain()) continue;
+
+        Coord_i = target_geometry->node[Point_Target]->GetCoord();
+
+        DonorTree.FindNearest(Coord_i, nNear, Near_Points, Near_Dist);
+        Target_nDonor[iVertexTarget] = Near_Points.size();
+        for (iDonor = 0; iDonor < Near_Points.size(); iDonor++)
+          Target_Donor[iVertexTarget*nNear+iDonor] = Near_Points[iDonor];
+
+        if (padding >= cover_padding) continue;
+
+        if (Near_Points.size() < nNear){
+          Search_Fail = 1; fail_padding = cover_padding;
+          continue;
+        }
+
+        dist = sqrt(Near_Dist.back());
+        if (!Check_BoundingBox(Coord_i, dist, padding, nDim)){
+          Search_Fail = 1; fail_padding = max(fail_padding, min(dist, cover_padding));
+        }
+      }
+
+#ifdef HAVE_MPI
+      SU2_MPI::Allreduce(&Search_Fail, &Search_Fail_Global, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#else
+      Search_Fail_Global = Search_Fail;
+#endif
+
+      padding = max(2.0*padding, fail_padding);
+
+    } while (Search_Fail_Global != 0);
+
+    /*--- Interpolation coefficients of each target point ---*/
+    for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+
+      Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+      if (!target_geometry->node[Point_Target]->GetDomain()) continue;
+
+      Coord_i = target_geometry->node[Point_Target]->GetCoord();
+      nDonor  = Target_nDonor[iVertexTarget];
+
+      for (iDonor = 0; iDonor < nDonor; iDonor++){
+        iElem = Target_Donor[iVertexTarget*nNear+iDonor];
+        for (iDim = 0; iDim < nDim; iDim++)
+          X[iDonor*nDim+iDim] = Donor_Coord[iElem*nDim+iDim];
+      }
+
+      /*--- Degenerate donor sets use the nearest donor ---*/
+      if ((nDonor > 0) && !Get_LocalCoeff(nDim, nDonor, Kind_RBF, &X[0], Coord_i, &myCoeff[0])){
+        nDonor = 1; myCoeff[0] = 1.0;
+      }
+
+      target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(nDonor);
+      target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo();
+
+      for (iDonor = 0; iDonor < nDonor; iDonor++){
+        iElem = Target_Donor[iVertexTarget*nNear+iDonor];
+        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, Donor_GlobalPoint[iElem]);
+        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, Donor_Processor[iElem]);
+        target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, myCoeff[iDonor]);
+      }
+    }
+
+  }
+
+}
+
+su2double CRadialBasisFunction::Get_RadialBasisValue(unsigned short val_kind, su2double val_dist, su2double val_radius){
+
+  su2double r = val_dist/val_radius;
+
+  /*--- Wendland functions, compact support of radius val_radius ---*/
+
+  if (r >= 1.0) return 0.0;
+
+  switch (val_kind) {
+    case WENDLAND_C0: return pow(1.0-r, 2.0);
+    case WENDLAND_C2: return pow(1.0-r, 4.0)*(4.0*r+1.0);
+    case WENDLAND_C4: return pow(1.0-r, 6.0)*(35.0*r*r+18.0*r+3.0)/3.0;
+  }
+
+  return 0.0;
+
+}
+
+bool CRadialBasisFunction::Get_LocalCoeff(unsigned short nDim, unsigned short nDonor, unsigned short Kind_RBF,
+                                          su2double *X, su2double *Coord_i, su2double *myCoeff){
+
+  unsigned short iDonor, jDonor, kDonor, iDim, iPoly, jPoly, kPoly, nPoly = nDim+1, nActive;
+  su2double Radius = 0.0, Dist, Value, Pivot, Ratio;
+
+  if (nDonor == 1){ myCoeff[0] = 1.0; return true; }
+
+  /*--- Support radius: half as large again as the distance to the farthest donor ---*/
+
+  for (iDonor = 0; iDonor < nDonor; iDonor++){
+    Dist = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Dist += pow(X[iDonor*nDim+iDim]-Coord_i[iDim], 2.0);
+    Radius = max(Radius, sqrt(Dist));
+  }
+  if (Radius == 0.0) return false;
+  Radius *= 1.5;
+
+  /*--- Cholesky factorization (lower triangle) of the interpolation matrix ---*/
+
+  vector<su2double> L(nDonor*nDonor, 0.0), P(nDonor*nPoly), Y(nDonor*nPoly), z(nDonor), S(nPoly*nPoly, 0.0), r(nPoly, 0.0);
+
+  for (iDonor = 0; iDonor < nDonor; iDonor++){
+    for (jDonor = 0; jDonor <= iDonor; jDonor++){
+      Dist = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) Dist += pow(X[iDonor*nDim+iDim]-X[jDonor*nDim+iDim], 2.0);
+      L[iDonor*nDonor+jDonor] = Get_RadialBasisValue(Kind_RBF, sqrt(Dist), Radius);
+    }
+  }
+
+  for (jDonor = 0; jDonor < nDonor; jDonor++){
+    for (kDonor = 0; kDonor < jDonor; kDonor++)
+      L[jDonor*nDonor+jDonor] -= pow(L[jDonor*nDonor+kDonor], 2.0);
+    if (L[jDonor*nDonor+jDonor] <= 0.0) return false;
+    L[jDonor*nDonor+jDonor] = sqrt(L[jDonor*nDonor+jDonor]);
+    for (iDonor = jDonor+1; iDonor < nDonor; iDonor++){
+      for (kDonor = 0; kDonor < jDonor; kDonor++)
+        L[iDonor*nDonor+jDonor] -= L[iDonor*nDonor+kDonor]*L[jDonor*nDonor+kDonor];
+      L[iDonor*nDonor+jDonor] /= L[jDonor*nDonor+jDonor];
+    }
+  }
+
+  /*--- Polynomial (1, x) centered at the target point and scaled with the radius,
+   right hand sides: the polynomial terms and the basis functions at the target ---*/
+
+  for (iDonor = 0; iDonor < nDonor; iDonor++){
+    P[iDonor*nPoly] = 1.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      P[iDonor*nPoly+1+iDim] = (X[iDonor*nDim+iDim]-Coord_i[iDim])/Radius;
+    Dist = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Dist += pow(X[iDonor*nDim+iDim]-Coord_i[iDim], 2.0);
+    z[iDonor] = Get_RadialBasisValue(Kind_RBF, sqrt(Dist), Radius);
+  }
+  Y = P;
+
+  /*--- Y = Phi^-1 P and z = Phi^-1 phi, forward and backward substitution ---*/
+
+  for (iPoly = 0; iPoly <= nPoly; iPoly++){
+    for (iDonor = 0; iDonor < nDonor; iDonor++){
+      Value = (iPoly < nPoly)? Y[iDonor*nPoly+iPoly] : z[iDonor];
+      for (jDonor = 0; jDonor < iDonor; jDonor++)
+        Value -= L[iDonor*nDonor+jDonor]*((iPoly < nPoly)? Y[jDonor*nPoly+iPoly] : z[jDonor]);
+      if (iPoly < nPoly) Y[iDonor*nPoly+iPoly] = Value/L[iDonor*nDonor+iDonor];
+      else z[iDonor] = Value/L[iDonor*nDonor+iDonor];
+    }
+    for (iDonor = nDonor; iDonor-- > 0; ){
+      Value = (iPoly < nPoly)? Y[iDonor*nPoly+iPoly] : z[iDonor];
+      for (jDonor = iDonor+1; jDonor < nDonor; jDonor++)
+        Value -= L[jDonor*nDonor+iDonor]*((iPoly < nPoly)? Y[jDonor*nPoly+iPoly] : z[jDonor]);
+      if (iPoly < nPoly) Y[iDonor*nPoly+iPoly] = Value/L[iDonor*nDonor+iDonor];
+      else z[iDonor] = Value/L[iDonor*nDonor+iDonor];
+    }
+  }
+
+  /*--- Schur complement S = P^T Phi^-1 P and right hand side P^T Phi^-1 phi - p,
+   the polynomial at the target point is (1, 0) ---*/
+
+  for (iPoly = 0; iPoly < nPoly; iPoly++){
+    for (jPoly = 0; jPoly < nPoly; jPoly++)
+      for (iDonor = 0; iDonor < nDonor; iDonor++)
+        S[iPoly*nPoly+jPoly] += P[iDonor*nPoly+iPoly]*Y[iDonor*nPoly+jPoly];
+    for (iDonor = 0; iDonor < nDonor; iDonor++)
+      r[iPoly] += P[iDonor*nPoly+iPoly]*z[iDonor];
+  }
+  r[0] -= 1.0;
+
+  /*--- Symmetric elimination with pivoting on the largest relative diagonal, the constant
+   first. Linear terms that are not independent on the donor set (flat or straight
+   interfaces) are dropped, with their multiplier set to zero ---*/
+
+  vector<su2double> W(S), lambda(nPoly, 0.0);
+  vector<unsigned short> Order;
+  vector<bool> Active(nPoly, false);
+
+  for (nActive = 0; nActive < nPoly; nActive++){
+    kPoly = nPoly;
+    if (nActive == 0) kPoly = 0;
+    else {
+      Ratio = 1E-10;
+      for (iPoly = 1; iPoly < nPoly; iPoly++){
+        if (Active[iPoly] || (S[iPoly*nPoly+iPoly] <= 0.0)) continue;
+        if (W[iPoly*nPoly+iPoly]/S[iPoly*nPoly+iPoly] > Ratio){
+          Ratio = W[iPoly*nPoly+iPoly]/S[iPoly*nPoly+iPoly]; kPoly = iPoly;
+        }
+      }
+    }
+    if ((kPoly == nPoly) || (W[kPoly*nPoly+kPoly] <= 0.0)) break;
+    Active[kPoly] = true; Order.push_back(kPoly);
+    Pivot = W[kPoly*nPoly+kPoly];
+    for (iPoly = 0; iPoly < nPoly; iPoly++){
+      if (Active[iPoly]) continue;
+      for (jPoly = 0; jPoly < nPoly; jPoly++){
+        if (Active[jPoly]) continue;
+        W[iPoly*nPoly+jPoly] -= W[iPoly*nPoly+kPoly]*W[kPoly*nPoly+jPoly]/Pivot;
+      }
+    }
+  }
+  if (Order.empty()) return false;
+
+  /*--- Solve the system of the active terms (Gaussian elimination) ---*/
+
+  nActive = Order.size();
+  vector<su2double> A(nActive*(nActive+1));
+  for (iPoly = 0; iPoly < nActive; iPoly++){
+    for (jPoly = 0; jPoly < nActive; jPoly++)
+      A[iPoly*(nActive+1)+jPoly] = S[Order[iPoly]*nPoly+Order[jPoly]];
+    A[iPoly*(nActive+1)+nActive] = r[Order[iPoly]];
+  }
+  for (kPoly = 0; kPoly < nActive; kPoly++){
+    jPoly = kPoly;
+    for (iPoly = kPoly+1; iPoly < nActive; iPoly++)
+      if (fabs(A[iPoly*(nActive+1)+kPoly]) > fabs(A[jPoly*(nActive+1)+kPoly])) jPoly = iPoly;
+    if (jPoly != kPoly)
+      for (iPoly = 0; iPoly <= nActive; iPoly++)
+        swap(A[kPoly*(nActive+1)+iPoly], A[jPoly*(nActive+1)+iPoly]);
+    for (iPoly = kPoly+1; iPoly < nActive; iPoly++){
+      Value = A[iPoly*(nActive+1)+kPoly]/A[kPoly*(nActive+1)+kPoly];
+      for (jPoly = kPoly; jPoly <= nActive; jPoly++)
+        A[iPoly*(nActive+1)+jPoly] -= Value*A[kPoly*(nActive+1)+jPoly];
+    }
+  }
+  for (kPoly = nActive; kPoly-- > 0; ){
+    Value = A[kPoly*(nActive+1)+nActive];
+    for (jPoly = kPoly+1; jPoly < nActive; jPoly++)
+      Value -= A[kPoly*(nActive+1)+jPoly]*lambda[Order[jPoly]];
+    lambda[Order[kPoly]] = Value/A[kPoly*(nActive+1)+kPoly];
+  }
+
+  /*--- Coefficients c = Phi^-1 (phi - P lambda) ---*/
+
+  for (iDonor = 0; iDonor < nDonor; iDonor++){
+    myCoeff[iDonor] = z[iDonor];
+    for (iPoly = 0; iPoly < nPoly; iPoly++)
+      myCoeff[iDonor] -= Y[iDonor*nPoly+iPoly]*lambda[iPoly];
+  }
+
+  return true;
+
+}
+
+/* Mortar Interpolator */
+CMortar::CMortar(CGeometry ***geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone) :  CInterpolator(geometry_container, config, iZone, jZone){
+
+  /*--- Initialize transfer coefficients between the zones ---*/
+  Set_TransferCoeff(config);
+
+}
+
+CMortar::~CMortar(){}
+
+void CMortar::Collect_TargetFaces(int markTarget, unsigned short nDim, vector<unsigned long> &FaceIndex,
+                                  vector<unsigned long> &FaceNodes, vector<unsigned long> &FaceVertex){
+  unsigned long iElem, iPoint;
+  unsigned short iNode, nNodes;
+  bool local;
+
+  FaceIndex.assign(1, 0);
+  FaceNodes.clear();
+  FaceVertex.clear();
+
+  if (markTarget == -1) return;
+
+  /*--- The boundary elements of the marker (each processor has those with at least one of its nodes) ---*/
+  for (iElem = 0; iElem < target_geometry->GetnElem_Bound(markTarget); iElem++){
+    nNodes = target_geometry->bound[markTarget][iElem]->GetnNodes();
+    local = false;
+    for (iNode = 0; iNode < nNodes; iNode++){
+      iPoint = target_geometry->bound[markTarget][iElem]->GetNode(iNode);
+      local = (local || target_geometry->node[iPoint]->GetDomain());
+    }
+    if (!local) continue;
+    for (iNode = 0; iNode < nNodes; iNode++)
+      FaceNodes.push_back(target_geometry->bound[markTarget][iElem]->GetNode(iNode));
+    iPoint = target_geometry->bound[markTarget][iElem]->GetNode(0);
+    FaceVertex.push_back(target_geometry->node[iPoint]->GetVertex(markTarget));
+    FaceIndex.push_back(FaceNodes.size());
+  }
+}
+
+void CMortar::Get_ShapeFunctions(unsigned short nNodes, su2double *U, su2double *u, su2double *N){
+  unsigned short iNode, iIter;
+  su2double det, xi = 0.0, eta = 0.0, dxi, deta, r[2], J[2][2], dNdxi[4], dNdeta[4];
+
+  switch (nNodes) {
+
+    /*--- Line ---*/
+    case 2:
+      N[0] = (U[2]-u[0])/(U[2]-U[0]);
+      N[1] = 1.0-N[0];
+      break;
+
+    /*--- Triangle, barycentric coordinates ---*/
+    case 3:
+      det  = (U[2]-U[0])*(U[5]-U[1]) - (U[4]-U[0])*(U[3]-U[1]);
+      N[1] = ((u[0]-U[0])*(U[5]-U[1]) - (U[4]-U[0])*(u[1]-U[1]))/det;
+      N[2] = ((U[2]-U[0])*(u[1]-U[1]) - (u[0]-U[0])*(U[3]-U[1]))/det;
+      N[0] = 1.0-N[1]-N[2];
+      break;
+
+    /*--- Quadrilateral, the bilinear map is inverted with Newton's method ---*/
+    case 4:
+      for (iIter = 0; iIter < 20; iIter++){
+        N[0] = 0.25*(1.0-xi)*(1.0-eta); N[1] = 0.25*(1.0+xi)*(1.0-eta);
+        N[2] = 0.25*(1.0+xi)*(1.0+eta); N[3] = 0.25*(1.0-xi)*(1.0+eta);
+        dNdxi[0]  = -0.25*(1.0-eta); dNdxi[1]  =  0.25*(1.0-eta); dNdxi[2]  = 0.25*(1.0+eta); dNdxi[3]  = -0.25*(1.0+eta);
+        dNdeta[0] = -0.25*(1.0-xi);  dNdeta[1] = -0.25*(1.0+xi);  dNdeta[2] = 0.25*(1.0+xi);  dNdeta[3] =  0.25*(1.0-xi);
+        r[0] = -u[0]; r[1] = -u[1];
+        J[0][0] = 0.0; J[0][1] = 0.0; J[1][0] = 0.0; J[1][1] = 0.0;
+        for (iNode = 0; iNode < 4; iNode++){
+          r[0] += N[iNode]*U[2*iNode]; r[1] += N[iNode]*U[2*iNode+1];
+          J[0][0] += dNdxi[iNode]*U[2*iNode];   J[0][1] += dNdeta[iNode]*U[2*iNode];
+          J[1][0] += dNdxi[iNode]*U[2*iNode+1]; J[1][1] += dNdeta[iNode]*U[2*iNode+1];
+        }
+        det  = J[0][0]*J[1][1] - J[0][1]*J[1][0];
+        if (det == 0.0) break;
+        dxi  = -( J[1][1]*r[0] - J[0][1]*r[1])/det;
+        deta = -(-J[1][0]*r[0] + J[0][0]*r[1])/det;
+        xi += dxi; eta += deta;
+        if (fabs(dxi)+fabs(deta) < 1E-12) break;
+      }
+      N[0] = 0.25*(1.0-xi)*(1.0-eta); N[1] = 0.25*(1.0+xi)*(1.0-eta);
+      N[2] = 0.25*(1.0+xi)*(1.0+eta); N[3] = 0.25*(1.0-xi)*(1.0+eta);
+      break;
+  }
+}
+
+unsigned short CMortar::Clip_Polygon(unsigned short nSubject, su2double *Subject, unsigned short nClip, su2double *Clip,
+                                     su2double *Result){
+  unsigned short iClip, iVertex, nInput, nOutput = nSubject;
+  su2double Input[32], Start[2], End[2], sStart, sEnd, t;
+  bool inStart, inEnd;
+
+  for (iVertex = 0; iVertex < 2*nSubject; iVertex++) Result[iVertex] = Subject[iVertex];
+
+  /*--- Keep the part of the polygon on the left of each edge of the convex polygon ---*/
+  for (iClip = 0; iClip < nClip && nOutput > 0; iClip++){
+
+    su2double *A = &Clip[2*iClip], *B = &Clip[2*((iClip+1)%nClip)];
+
+    nInput = nOutput; nOutput = 0;
+    for (iVertex = 0; iVertex < 2*nInput; iVertex++) Input[iVertex] = Result[iVertex];
+
+    Start[0] = Input[2*(nInput-1)]; Start[1] = Input[2*(nInput-1)+1];
+    sStart   = (B[0]-A[0])*(Start[1]-A[1]) - (B[1]-A[1])*(Start[0]-A[0]);
+
+    for (iVertex = 0; iVertex < nInput; iVertex++){
+      End[0] = Input[2*iVertex]; End[1] = Input[2*iVertex+1];
+      sEnd   = (B[0]-A[0])*(End[1]-A[1]) - (B[1]-A[1])*(End[0]-A[0]);
+      inStart = (sStart >= 0.0); inEnd = (sEnd >= 0.0);
+      if (inStart != inEnd){
+        t = sStart/(sStart-sEnd);
+        Result[2*nOutput]   = Start[0] + t*(End[0]-Start[0]);
+        Result[2*nOutput+1] = Start[1] + t*(End[1]-Start[1]);
+        nOutput++;
+      }
+      if (inEnd){
+        Result[2*nOutput] = End[0]; Result[2*nOutput+1] = End[1];
+        nOutput++;
+      }
+      Start[0] = End[0]; Start[1] = End[1]; sStart = sEnd;
+    }
+  }
+
+  return nOutput;
+}
+
+void CMortar::Set_TransferCoeff(CConfig **config){
+
+  unsigned short iDim, iNode, jNode, nNodes, nNodesDonor, iDonor, nDonor, iQuad, nQuad, nPoly, iPoly;
+  unsigned short nDim = donor_geometry->GetnDim();
+
+  unsigned short nMarkerInt, nMarkerDonor, nMarkerTarget;
+  unsigned short iMarkerInt, iMarkerDonor, iMarkerTarget;
+  int markDonor = -1, markTarget = -1;
+
+  unsigned long nVertexTarget = 0, iVertex, iPoint, iFace, nFace, iElem, jElem, kElem, nDonorElem, iDonorNode;
+
+  unsigned short Search_Fail, Search_Fail_Global;
+
+  su2double padding, cover_padding, need_padding, target_radius, maxradius, radius, area, weight, sum, dist, value;
+  su2double X[12], XD[12], Center[3], Normal[3], Tangent[2][3], U[8], UD[8], UT_ccw[8], UD_ccw[8], Poly[32];
+  su2double u[2], NT[4], ND[4], lo, hi, *NormalDonor, *Coord_i;
+
+  vector<unsigned long> FaceIndex, FaceNodes, FaceVertex, Candidates;
+  vector<su2double> Centroid, FaceRadius, DonorCentroid, DonorRadius;
+
+  /*--- Quadrature: two Gauss points on the segments in 2D, three points per triangle of the intersections in 3D ---*/
+  const su2double Gauss[2] = {0.5-0.5/sqrt(3.0), 0.5+0.5/sqrt(3.0)};
+  const su2double Bary[3][3] = {{2.0/3.0, 1.0/6.0, 1.0/6.0}, {1.0/6.0, 2.0/3.0, 1.0/6.0}, {1.0/6.0, 1.0/6.0, 2.0/3.0}};
+
+  /*--- Number of markers on the FSI interface ---*/
+  nMarkerInt     = (config[donorZone]->GetMarker_n_FSIinterface())/2;
+  nMarkerTarget  = target_geometry->GetnMarker();
+  nMarkerDonor   = donor_geometry->GetnMarker();
+
+  // For the markers on the interface
+  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+
+    markDonor = -1;
+    markTarget = -1;
+
+    /*--- On the donor side ---*/
+
+    for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
+      /*--- If the tag GetMarker_All_FSIinterface(iMarkerDonor) equals the index we are looping at ---*/
+      if (config[donorZone]->GetMarker_All_FSIinterface(iMarkerDonor) == iMarkerInt ){
+        /*--- We have identified the identifier for the structural marker ---*/
+        markDonor = iMarkerDonor;
+        break;
+      }
+      else {
+        /*--- If the tag hasn't matched any tag within the donor markers ---*/
+        markDonor = -1;
+      }
+    }
+
+    /*--- On the target side ---*/
+    for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
+      /*--- If the tag GetMarker_All_FSIinterface(iMarkerFlow) equals the index we are looping at ---*/
+      if (config[targetZone]->GetMarker_All_FSIinterface(iMarkerTarget) == iMarkerInt ){
+        /*--- We have identified the identifier for the target marker ---*/
+        markTarget = iMarkerTarget;
+        /*--- Store the number of local points that belong to markTarget ---*/
+        nVertexTarget = target_geometry->GetnVertex(iMarkerTarget);
+        break;
+      }
+      else {
+        /*--- If the tag hasn't matched any tag within the Flow markers ---*/
+        nVertexTarget = 0;
+        markTarget = -1;
+      }
+    }
+
+    /*--- Bounding box of the local target vertices, local donor faces and local target faces ---*/
+    Set_TargetBoundingBox(markTarget, nDim);
+    Collect_DonorElements(true, markDonor, nDim);
+    Collect_TargetFaces(markTarget, nDim, FaceIndex, FaceNodes, FaceVertex);
+
+    nFace = FaceIndex.size()-1;
+    Centroid.assign(nFace*nDim, 0.0);
+    FaceRadius.assign(nFace, 0.0);
+    target_radius = 0.0;
+    for (iFace = 0; iFace < nFace; iFace++){
+      nNodes = FaceIndex[iFace+1]-FaceIndex[iFace];
+      for (iNode = 0; iNode < nNodes; iNode++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Centroid[iFace*nDim+iDim] += target_geometry->node[FaceNodes[FaceIndex[iFace]+iNode]]->GetCoord(iDim)/su2double(nNodes);
+      for (iNode = 0; iNode < nNodes; iNode++){
+        radius = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          radius += pow(target_geometry->node[FaceNodes[FaceIndex[iFace]+iNode]]->GetCoord(iDim)-Centroid[iFace*nDim+iDim], 2.0);
+        FaceRadius[iFace] = max(FaceRadius[iFace], sqrt(radius));
+      }
+      target_radius = max(target_radius, FaceRadius[iFace]);
+    }
+
+    /*--- The donor faces that can intersect a target face have their centroid within twice the
+     target face radius (the gap between the surfaces is allowed to be one face radius) plus the
+     largest donor face radius of the face centroid. Those faces overlap the target box padded
+     with three target face radii plus the largest donor face radius ---*/
+    padding = 3.0*target_radius;
+
+    do {
+
+      Exchange_DonorElements(true, nDim, padding);
+
+      nDonorElem = Donor_ElemIndex.size()-1;
+      DonorCentroid.assign(nDonorElem*nDim, 0.0);
+      DonorRadius.assign(nDonorElem, 0.0);
+      maxradius = 0.0;
+      for (iElem = 0; iElem < nDonorElem; iElem++){
+        nNodesDonor = Donor_ElemIndex[iElem+1]-Donor_ElemIndex[iElem];
+        for (iDonorNode = Donor_ElemIndex[iElem]; iDonorNode < Donor_ElemIndex[iElem+1]; iDonorNode++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            DonorCentroid[iElem*nDim+iDim] += Donor_Coord[iDonorNode*nDim+iDim]/su2double(nNodesDonor);
+        for (iDonorNode = Donor_ElemIndex[iElem]; iDonorNode < Donor_ElemIndex[iElem+1]; iDonorNode++){
+          radius = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            radius += pow(Donor_Coord[iDonorNode*nDim+iDim]-DonorCentroid[iElem*nDim+iDim], 2.0);
+          DonorRadius[iElem] = max(DonorRadius[iElem], sqrt(radius));
+        }
+        maxradius = max(maxradius, DonorRadius[iElem]);
+      }
+
+      cover_padding = Get_CoverPadding(nDim);
+      need_padding  = 3.0*target_radius + maxradius;
+      Search_Fail   = 0;
+      if ((nFace > 0) && (padding < cover_padding) && (padding < need_padding)){
+        Search_Fail = 1;
+        padding = max(2.0*padding, need_padding);
+      }
+
+#ifdef HAVE_MPI
+      SU2_MPI::Allreduce(&Search_Fail, &Search_Fail_Global, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#else
+      Search_Fail_Global = Search_Fail;
+#endif
+
+    } while (Search_Fail_Global != 0);
+
+    CKDTree FaceTree(nDonorElem, nDim, (nDonorElem > 0)? &DonorCentroid[0] : NULL);
+
+    /*--- Mass matrix of the target shape functions times the donor shape functions, row by row
+     (target vertex), indexed by the global index of the donor point ---*/
+    vector<map<unsigned long, su2double> > Row(nVertexTarget);
+    map<unsigned long, int> Donor_Owner;
+    map<unsigned long, su2double>::iterator it;
+
+    for (iFace = 0; iFace < nFace; iFace++){
+
+      nNodes = FaceIndex[iFace+1]-FaceIndex[iFace];
+      for (iNode = 0; iNode < nNodes; iNode++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          X[iNode*3+iDim] = target_geometry->node[FaceNodes[FaceIndex[iFace]+iNode]]->GetCoord(iDim);
+      for (iDim = 0; iDim < nDim; iDim++) Center[iDim] = Centroid[iFace*nDim+iDim];
+
+      /*--- Plane of the face: the normal (of the vertex normals' orientation) and the tangent directions ---*/
+      NormalDonor = target_geometry->vertex[markTarget][FaceVertex[iFace]]->GetNormal();
+      if (nDim == 2){
+        Tangent[0][0] = X[3]-X[0]; Tangent[0][1] = X[4]-X[1];
+        Normal[0] = Tangent[0][1]; Normal[1] = -Tangent[0][0];
+      }
+      else {
+        /*--- Newell's method ---*/
+        Normal[0] = 0.0; Normal[1] = 0.0; Normal[2] = 0.0;
+        for (iNode = 0; iNode < nNodes; iNode++){
+          jNode = (iNode+1)%nNodes;
+          Normal[0] += (X[iNode*3+1]-X[jNode*3+1])*(X[iNode*3+2]+X[jNode*3+2]);
+          Normal[1] += (X[iNode*3+2]-X[jNode*3+2])*(X[iNode*3+0]+X[jNode*3+0]);
+          Normal[2] += (X[iNode*3+0]-X[jNode*3+0])*(X[iNode*3+1]+X[jNode*3+1]);
+        }
+      }
+      dist = 0.0; value = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++){ dist += Normal[iDim]*Normal[iDim]; value += Normal[iDim]*NormalDonor[iDim]; }
+      if (dist == 0.0) continue;
+      dist = sqrt(dist);
+      if (value < 0.0) dist = -dist;
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] /= dist;
+
+      if (nDim == 2){
+        Tangent[0][0] = -Normal[1]; Tangent[0][1] = Normal[0];
+      }
+      else {
+        value = 0.0;
+        for (iDim = 0; iDim < 3; iDim++){ Tangent[0][iDim] = X[3+iDim]-X[iDim]; value += Tangent[0][iDim]*Normal[iDim]; }
+        for (iDim = 0; iDim < 3; iDim++) Tangent[0][iDim] -= value*Normal[iDim];
+        value = sqrt(Tangent[0][0]*Tangent[0][0]+Tangent[0][1]*Tangent[0][1]+Tangent[0][2]*Tangent[0][2]);
+        for (iDim = 0; iDim < 3; iDim++) Tangent[0][iDim] /= value;
+        Tangent[1][0] = Normal[1]*Tangent[0][2]-Normal[2]*Tangent[0][1];
+        Tangent[1][1] = Normal[2]*Tangent[0][0]-Normal[0]*Tangent[0][2];
+        Tangent[1][2] = Normal[0]*Tangent[0][1]-Normal[1]*Tangent[0][0];
+      }
+
+      /*--- Coordinates of the nodes in the plane, counterclockwise copy for the clipping ---*/
+      for (iNode = 0; iNode < nNodes; iNode++){
+        U[2*iNode] = 0.0; U[2*iNode+1] = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++){
+          U[2*iNode] += (X[iNode*3+iDim]-Center[iDim])*Tangent[0][iDim];
+          if (nDim == 3) U[2*iNode+1] += (X[iNode*3+iDim]-Center[iDim])*Tangent[1][iDim];
+        }
+      }
+      area = 0.0;
+      for (iNode = 0; iNode < nNodes; iNode++){
+        jNode = (iNode+1)%nNodes;
+        area += 0.5*(U[2*iNode]*U[2*jNode+1]-U[2*jNode]*U[2*iNode+1]);
+      }
+      for (iNode = 0; iNode < nNodes; iNode++){
+        jNode = (area >= 0.0)? iNode : nNodes-1-iNode;
+        UT_ccw[2*iNode] = U[2*jNode]; UT_ccw[2*iNode+1] = U[2*jNode+1];
+      }
+
+      FaceTree.FindRadius(Center, 2.0*FaceRadius[iFace]+maxradius, Candidates);
+
+      for (kElem = 0; kElem < Candidates.size(); kElem++){
+
+        jElem = Candidates[kElem];
+        nNodesDonor = Donor_ElemIndex[jElem+1]-Donor_ElemIndex[jElem];
+
+        /*--- The donor face must face the target face, and be at most a face radius away from its plane ---*/
+        value = 0.0; dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++){
+          value += Donor_Normal[jElem*nDim+iDim]*Normal[iDim];
+          dist  += (DonorCentroid[jElem*nDim+iDim]-Center[iDim])*Normal[iDim];
+        }
+        if ((value >= 0.0) || (fabs(dist) > FaceRadius[iFace]+DonorRadius[jElem])) continue;
+
+        for (iDonor = 0; iDonor < nNodesDonor; iDonor++){
+          iDonorNode = Donor_ElemIndex[jElem]+iDonor;
+          for (iDim = 0; iDim < nDim; iDim++) XD[iDonor*3+iDim] = Donor_Coord[iDonorNode*nDim+iDim];
+          UD[2*iDonor] = 0.0; UD[2*iDonor+1] = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++){
+            UD[2*iDonor] += (XD[iDonor*3+iDim]-Center[iDim])*Tangent[0][iDim];
+            if (nDim == 3) UD[2*iDonor+1] += (XD[iDonor*3+iDim]-Center[iDim])*Tangent[1][iDim];
+          }
+        }
+
+        /*--- Quadrature points of the intersection (u, weight) ---*/
+        vector<su2double> Quad;
+
+        if (nDim == 2){
+          if (UD[0] == UD[2]) continue;
+          lo = max(min(U[0], U[2]), min(UD[0], UD[2]));
+          hi = min(max(U[0], U[2]), max(UD[0], UD[2]));
+          if (hi <= lo) continue;
+          for (iQuad = 0; iQuad < 2; iQuad++){
+            Quad.push_back(lo+Gauss[iQuad]*(hi-lo)); Quad.push_back(0.0); Quad.push_back(0.5*(hi-lo));
+          }
+        }
+        else {
+          area = 0.0;
+          for (iDonor = 0; iDonor < nNodesDonor; iDonor++){
+            jNode = (iDonor+1)%nNodesDonor;
+            area += 0.5*(UD[2*iDonor]*UD[2*jNode+1]-UD[2*jNode]*UD[2*iDonor+1]);
+          }
+          if (area == 0.0) continue;
+          for (iDonor = 0; iDonor < nNodesDonor; iDonor++){
+            jNode = (area > 0.0)? iDonor : nNodesDonor-1-iDonor;
+            UD_ccw[2*iDonor] = UD[2*jNode]; UD_ccw[2*iDonor+1] = UD[2*jNode+1];
+          }
+          nPoly = Clip_Polygon(nNodesDonor, UD_ccw, nNodes, UT_ccw, Poly);
+          for (iPoly = 1; iPoly+1 < nPoly; iPoly++){
+            area = 0.5*((Poly[2*iPoly]-Poly[0])*(Poly[2*iPoly+3]-Poly[1]) -
+                        (Poly[2*iPoly+2]-Poly[0])*(Poly[2*iPoly+1]-Poly[1]));
+            if (area <= 0.0) continue;
+            for (iQuad = 0; iQuad < 3; iQuad++){
+              Quad.push_back(Bary[iQuad][0]*Poly[0]+Bary[iQuad][1]*Poly[2*iPoly]+Bary[iQuad][2]*Poly[2*iPoly+2]);
+              Quad.push_back(Bary[iQuad][0]*Poly[1]+Bary[iQuad][1]*Poly[2*iPoly+1]+Bary[iQuad][2]*Poly[2*iPoly+3]);
+              Quad.push_back(area/3.0);
+            }
+          }
+        }
+
+        nQuad = Quad.size()/3;
+        for (iQuad = 0; iQuad < nQuad; iQuad++){
+          u[0] = Quad[3*iQuad]; u[1] = Quad[3*iQuad+1]; weight = Quad[3*iQuad+2];
+          Get_ShapeFunctions(nNodes, U, u, NT);
+          Get_ShapeFunctions(nNodesDonor, UD, u, ND);
+          for (iNode = 0; iNode < nNodes; iNode++){
+            iPoint = FaceNodes[FaceIndex[iFace]+iNode];
+            if (!target_geometry->node[iPoint]->GetDomain()) continue;
+            iVertex = target_geometry->node[iPoint]->GetVertex(markTarget);
+            for (iDonor = 0; iDonor < nNodesDonor; iDonor++){
+              iDonorNode = Donor_ElemIndex[jElem]+iDonor;
+              Row[iVertex][Donor_GlobalPoint[iDonorNode]] += weight*NT[iNode]*ND[iDonor];
+              Donor_Owner[Donor_GlobalPoint[iDonorNode]] = Donor_Processor[iDonorNode];
+            }
+          }
+        }
+      }
+    }
+
+    /*--- Scale the rows with the integral of the target shape functions over the intersections
+     (lumped mass). Negligible entries are dropped, target points without intersections (outside
+     of the donor surface) use the nearest donor point ---*/
+    nDonorElem = Donor_GlobalPoint.size();
+    CKDTree DonorTree(nDonorElem, nDim, (nDonorElem > 0)? &Donor_Coord[0] : NULL);
+
+    for (iVertex = 0; iVertex < nVertexTarget; iVertex++){
+
+      iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+      sum = 0.0;
+      for (it = Row[iVertex].begin(); it != Row[iVertex].end(); it++) sum += it->second;
+      value = 0.0; nDonor = 0;
+      for (it = Row[iVertex].begin(); it != Row[iVertex].end(); it++)
+        if (it->second > 1E-10*sum){ value += it->second; nDonor++; }
+
+      if (nDonor > 0){
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nDonor);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+        iDonor = 0;
+        for (it = Row[iVertex].begin(); it != Row[iVertex].end(); it++){
+          if (it->second <= 1E-10*sum) continue;
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor, it->first);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, Donor_Owner[it->first]);
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor, it->second/value);
+          iDonor++;
+        }
+      }
+      else if (nDonorElem > 0){
+        Coord_i = target_geometry->node[iPoint]->GetCoord();
+        iDonorNode = DonorTree.FindNearest(Coord_i, dist);
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(1);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(0, Donor_GlobalPoint[iDonorNode]);
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(0, Donor_Processor[iDonorNode]);
+        target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(0, 1.0);
+      }
+      else {
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(0);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+      }
+    }
+
+  }
+
+}
+
 /* Mirror Interpolator */
 CMirror::CMirror(CGeometry ***geometry_container, CConfig **config,  unsigned int iZone, unsigned int jZone) :  CInterpolator(geometry_container, config, iZone, jZone){
 
@@ -1005,33 +2308,30 @@ CMirror::~CMirror(){}
 
 void CMirror::Set_TransferCoeff(CConfig **config){
   unsigned long iVertex, jVertex;
-  unsigned long iPoint;
-  unsigned short iDonor=0, iFace=0, iTarget=0;
+  unsigned long iPoint, jPoint;
+  unsigned long Global_Point;
+  unsigned short iDonor, nDonor;
 
   unsigned short nMarkerInt, nMarkerDonor, nMarkerTarget;
   unsigned short iMarkerInt, iMarkerDonor, iMarkerTarget;
 
-  int markDonor=0, markTarget=0;
-
-  unsigned int nNodes=0, iNodes=0;
-  unsigned long nVertexDonor = 0, nVertexTarget= 0;
-  unsigned long Point_Donor = 0;
-  unsigned long Global_Point = 0;
-  unsigned long pGlobalPoint = 0;
-  int iProcessor;
-
-  unsigned long nLocalFace_Donor = 0, nLocalFaceNodes_Donor=0;
+  int markDonor = -1, markTarget = -1;
 
-  unsigned long faceindex;
+  unsigned long nVertexDonor = 0, nVertexTarget = 0, nRecv, iRecv;
+  int iProcessor, jProcessor;
 
-  int rank = MASTER_NODE;
   int nProcessor = SINGLE_NODE;
 #ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
 #endif
-  su2double *Buffer_Send_Coeff, *Buffer_Receive_Coeff;
-  su2double coeff;
+
+  vector<int> Send_Count(nProcessor), Recv_Count(nProcessor);
+  vector<unsigned long> Send_Offset(nProcessor+1), Recv_Offset(nProcessor+1);
+  vector<unsigned long> Buffer_Send_Point, Buffer_Receive_Point;
+  vector<su2double> Buffer_Send_Coeff, Buffer_Receive_Coeff;
+  vector<unsigned short> Target_nDonor;
+  map<unsigned long, unsigned long> Target_Vertex;
+  map<unsigned long, unsigned long>::iterator it;
 
   /*--- Number of markers on the interface ---*/
   nMarkerInt = (config[targetZone]->GetMarker_n_FSIinterface())/2;
@@ -1040,9 +2340,10 @@ void CMirror::Set_TransferCoeff(CConfig **config){
   /*--- For the number of markers on the interface... ---*/
   for (iMarkerInt=1; iMarkerInt <= nMarkerInt; iMarkerInt++){
     /*--- Procedure:
-     * -Loop through vertices of the aero grid
-     * -Find nearest element and allocate enough space in the aero grid donor point info
-     *    -set the transfer coefficient values
+     * -Each local donor vertex sends its (already interpolated) donor points and coefficients to
+     *  the processors that own those points
+     * -Each target vertex collects the donor vertices that use it, with the same coefficients
+     *  (transpose of the opposite interpolation)
      */
     markDonor = -1;
     markTarget = -1;
@@ -1082,164 +2383,115 @@ void CMirror::Set_TransferCoeff(CConfig **config){
       }
     }
 
-    /*-- Collect the number of donor nodes: re-use 'Face' containers --*/
-    nLocalFace_Donor=0;
-    nLocalFaceNodes_Donor=0;
-    for (jVertex = 0; jVertex<nVertexDonor; jVertex++) {
-      Point_Donor =donor_geometry->vertex[markDonor][jVertex]->GetNode(); // Local index of jVertex
+    /*--- Count the links to each owner of the target points, then pack (target, donor) pairs and coefficients ---*/
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) Send_Count[iProcessor] = 0;
+    for (jVertex = 0; jVertex < nVertexDonor; jVertex++) {
+      jPoint = donor_geometry->vertex[markDonor][jVertex]->GetNode();
+      if (!donor_geometry->node[jPoint]->GetDomain()) continue;
+      nDonor = donor_geometry->vertex[markDonor][jVertex]->GetnDonorPoints();
+      for (iDonor = 0; iDonor < nDonor; iDonor++)
+        Send_Count[donor_geometry->vertex[markDonor][jVertex]->GetInterpDonorProcessor(iDonor)]++;
+    }
 
-      if (donor_geometry->node[Point_Donor]->GetDomain()) {
-        nNodes = donor_geometry->vertex[markDonor][jVertex]->GetnDonorPoints();
-        nLocalFaceNodes_Donor+=nNodes;
-        nLocalFace_Donor++;
+    Send_Offset[0] = 0;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      Send_Offset[iProcessor+1] = Send_Offset[iProcessor]+Send_Count[iProcessor];
+
+    Buffer_Send_Point.resize(2*Send_Offset[nProcessor]);
+    Buffer_Send_Coeff.resize(Send_Offset[nProcessor]);
+    vector<unsigned long> Position(Send_Offset.begin(), Send_Offset.end()-1);
+
+    for (jVertex = 0; jVertex < nVertexDonor; jVertex++) {
+      jPoint = donor_geometry->vertex[markDonor][jVertex]->GetNode();
+      if (!donor_geometry->node[jPoint]->GetDomain()) continue;
+      nDonor = donor_geometry->vertex[markDonor][jVertex]->GetnDonorPoints();
+      for (iDonor = 0; iDonor < nDonor; iDonor++){
+        iProcessor = donor_geometry->vertex[markDonor][jVertex]->GetInterpDonorProcessor(iDonor);
+        Buffer_Send_Point[2*Position[iProcessor]]   = donor_geometry->vertex[markDonor][jVertex]->GetInterpDonorPoint(iDonor);
+        Buffer_Send_Point[2*Position[iProcessor]+1] = donor_geometry->node[jPoint]->GetGlobalIndex();
+        Buffer_Send_Coeff[Position[iProcessor]]     = donor_geometry->vertex[markDonor][jVertex]->GetDonorCoeff(iDonor);
+        Position[iProcessor]++;
       }
     }
-    Buffer_Send_nFace_Donor= new unsigned long [1];
-    Buffer_Send_nFaceNodes_Donor= new unsigned long [1];
-
-    Buffer_Receive_nFace_Donor = new unsigned long [nProcessor];
-    Buffer_Receive_nFaceNodes_Donor = new unsigned long [nProcessor];
 
-    Buffer_Send_nFace_Donor[0] = nLocalFace_Donor;
-    Buffer_Send_nFaceNodes_Donor[0] = nLocalFaceNodes_Donor;
-
-    /*--- Send Interface vertex information --*/
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&nLocalFaceNodes_Donor, &MaxFaceNodes_Donor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&nLocalFace_Donor, &MaxFace_Donor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_nFace_Donor, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nFace_Donor, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_nFaceNodes_Donor, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nFaceNodes_Donor, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    MaxFace_Donor++;
+    MPI_Alltoall(&Send_Count[0], 1, MPI_INT, &Recv_Count[0], 1, MPI_INT, MPI_COMM_WORLD);
 #else
-    nGlobalFace_Donor       = nLocalFace_Donor;
-    nGlobalFaceNodes_Donor  = nLocalFaceNodes_Donor;
-    MaxFaceNodes_Donor      = nLocalFaceNodes_Donor;
-    MaxFace_Donor           = nLocalFace_Donor+1;
-    Buffer_Receive_nFace_Donor[0] = Buffer_Send_nFace_Donor[0];
-    Buffer_Receive_nFaceNodes_Donor[0] = Buffer_Send_nFaceNodes_Donor[0];
+    Recv_Count[0] = Send_Count[0];
 #endif
 
-    /*-- Send donor info --*/
-    Buffer_Send_FaceIndex   = new unsigned long[MaxFace_Donor];
-    Buffer_Send_FaceNodes   = new unsigned long[MaxFaceNodes_Donor];
-    //Buffer_Send_FaceProc    = new unsigned long[MaxFaceNodes_Donor];
-    Buffer_Send_GlobalPoint = new unsigned long[MaxFaceNodes_Donor];
-    Buffer_Send_Coeff       = new su2double[MaxFaceNodes_Donor];
-
-    Buffer_Receive_FaceIndex= new unsigned long[MaxFace_Donor*nProcessor];
-    Buffer_Receive_FaceNodes= new unsigned long[MaxFaceNodes_Donor*nProcessor];
-    //Buffer_Receive_FaceProc = new unsigned long[MaxFaceNodes_Donor*nProcessor];
-    Buffer_Receive_GlobalPoint = new unsigned long[MaxFaceNodes_Donor*nProcessor];
-    Buffer_Receive_Coeff    = new su2double[MaxFaceNodes_Donor*nProcessor];
-
-    for (iVertex=0; iVertex<MaxFace_Donor; iVertex++){
-      Buffer_Send_FaceIndex[iVertex]=0;
-    }
-    for (iVertex=0; iVertex<MaxFaceNodes_Donor; iVertex++){
-      Buffer_Send_FaceNodes[iVertex]=0;
-      //Buffer_Send_FaceProc[iVertex]=0;
-      Buffer_Send_GlobalPoint[iVertex]=0;
-      Buffer_Send_Coeff[iVertex]=0.0;
-    }
-    for (iVertex=0; iVertex<MaxFace_Donor; iVertex++){
-      Buffer_Send_FaceIndex[iVertex]=0;
-    }
-
-    Buffer_Send_FaceIndex[0]=rank*MaxFaceNodes_Donor;
-    nLocalFace_Donor=0;
-    nLocalFaceNodes_Donor=0;
-
-    for (jVertex = 0; jVertex<nVertexDonor; jVertex++) {
-
-      Point_Donor =donor_geometry->vertex[markDonor][jVertex]->GetNode(); // Local index of jVertex
-      if (donor_geometry->node[Point_Donor]->GetDomain()) {
-        nNodes = donor_geometry->vertex[markDonor][jVertex]->GetnDonorPoints();
-        for (iDonor=0; iDonor<nNodes; iDonor++){
-          Buffer_Send_FaceNodes[nLocalFaceNodes_Donor] = donor_geometry->node[Point_Donor]->GetGlobalIndex();
-          Buffer_Send_GlobalPoint[nLocalFaceNodes_Donor] =
-              donor_geometry->vertex[markDonor][jVertex]->GetInterpDonorPoint(iDonor);
-          Buffer_Send_Coeff[nLocalFaceNodes_Donor] =
-              donor_geometry->vertex[markDonor][jVertex]->GetDonorCoeff(iDonor);
-          nLocalFaceNodes_Donor++;
-        }
-        Buffer_Send_FaceIndex[nLocalFace_Donor+1] =Buffer_Send_FaceIndex[nLocalFace_Donor]+nNodes;
-        nLocalFace_Donor++;
-      }
-    }
+    Recv_Offset[0] = 0;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor]+Recv_Count[iProcessor];
+    nRecv = Recv_Offset[nProcessor];
+
+    Buffer_Receive_Point.resize(2*nRecv+1);
+    Buffer_Receive_Coeff.resize(nRecv+1);
 
 #ifdef HAVE_MPI
-    SU2_MPI::Allgather(Buffer_Send_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_GlobalPoint, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG,Buffer_Receive_GlobalPoint, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_Coeff, MaxFaceNodes_Donor, MPI_DOUBLE,Buffer_Receive_Coeff, MaxFaceNodes_Donor, MPI_DOUBLE, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#else
-    for (iFace=0; iFace<MaxFace_Donor; iFace++){
-      Buffer_Receive_FaceIndex[iFace] = Buffer_Send_FaceIndex[iFace];
+    vector<MPI_Request> Request;
+    MPI_Request request;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+      if (Recv_Count[iProcessor] == 0) continue;
+      SU2_MPI::Irecv(&Buffer_Receive_Point[2*Recv_Offset[iProcessor]], 2*Recv_Count[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &request); Request.push_back(request);
+      SU2_MPI::Irecv(&Buffer_Receive_Coeff[Recv_Offset[iProcessor]], Recv_Count[iProcessor], MPI_DOUBLE,
+                     iProcessor, 1, MPI_COMM_WORLD, &request); Request.push_back(request);
+    }
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
+      if (Send_Count[iProcessor] == 0) continue;
+      SU2_MPI::Isend(&Buffer_Send_Point[2*Send_Offset[iProcessor]], 2*Send_Count[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, 0, MPI_COMM_WORLD, &request); Request.push_back(request);
+      SU2_MPI::Isend(&Buffer_Send_Coeff[Send_Offset[iProcessor]], Send_Count[iProcessor], MPI_DOUBLE,
+                     iProcessor, 1, MPI_COMM_WORLD, &request); Request.push_back(request);
     }
-    for (iVertex = 0; iVertex < MaxFaceNodes_Donor; iVertex++){
-      Buffer_Receive_FaceNodes[iVertex] = Buffer_Send_FaceNodes[iVertex];
-      Buffer_Receive_GlobalPoint[iVertex] = Buffer_Send_GlobalPoint[iVertex];
-      Buffer_Receive_Coeff[iVertex] = Buffer_Send_Coeff[iVertex];
+    if (!Request.empty())
+      SU2_MPI::Waitall(Request.size(), &Request[0], MPI_STATUSES_IGNORE);
+#else
+    for (iRecv = 0; iRecv < nRecv; iRecv++){
+      Buffer_Receive_Point[2*iRecv]   = Buffer_Send_Point[2*iRecv];
+      Buffer_Receive_Point[2*iRecv+1] = Buffer_Send_Point[2*iRecv+1];
+      Buffer_Receive_Coeff[iRecv]     = Buffer_Send_Coeff[iRecv];
     }
 #endif
-    /*--- Loop over the vertices on the target Marker ---*/
-    for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
 
+    /*--- Local target vertices by global index ---*/
+    Target_Vertex.clear();
+    for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
       iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
-      if (target_geometry->node[iPoint]->GetDomain()) {
-        Global_Point = target_geometry->node[iPoint]->GetGlobalIndex();
-        nNodes = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++){
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget])
-                nNodes++;
-              //coeff =Buffer_Receive_Coeff[faceindex+iDonor];
-            }
-          }
-        }
+      if (target_geometry->node[iPoint]->GetDomain())
+        Target_Vertex[target_geometry->node[iPoint]->GetGlobalIndex()] = iVertex;
+    }
 
-        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
-        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+    /*--- Number of donors of each target vertex, then the donors in the order of the sending processors ---*/
+    Target_nDonor.assign(nVertexTarget, 0);
+    for (iRecv = 0; iRecv < nRecv; iRecv++){
+      it = Target_Vertex.find(Buffer_Receive_Point[2*iRecv]);
+      if (it != Target_Vertex.end()) Target_nDonor[it->second]++;
+    }
 
-        iDonor = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++){
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++){
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget]){
-                coeff =Buffer_Receive_Coeff[faceindex+iTarget];
-                pGlobalPoint = Buffer_Receive_FaceNodes[faceindex+iTarget];
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
-                target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
-                //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;
-                iDonor++;
-              }
-            }
-          }
-        }
+    for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (target_geometry->node[iPoint]->GetDomain()) {
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(Target_nDonor[iVertex]);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+        Target_nDonor[iVertex] = 0;
       }
     }
-    delete[] Buffer_Send_nFace_Donor;
-    delete[] Buffer_Send_nFaceNodes_Donor;
-
-    delete[] Buffer_Receive_nFace_Donor;
-    delete[] Buffer_Receive_nFaceNodes_Donor;
 
-    delete[] Buffer_Send_FaceIndex;
-    delete[] Buffer_Send_FaceNodes;
-    delete[] Buffer_Send_GlobalPoint;
-    delete[] Buffer_Send_Coeff;
-
-    delete[] Buffer_Receive_FaceIndex;
-    delete[] Buffer_Receive_FaceNodes;
-    delete[] Buffer_Receive_GlobalPoint;
-    delete[] Buffer_Receive_Coeff;
+    for (jProcessor = 0; jProcessor < nProcessor; jProcessor++){
+      for (iRecv = Recv_Offset[jProcessor]; iRecv < Recv_Offset[jProcessor+1]; iRecv++){
+        Global_Point = Buffer_Receive_Point[2*iRecv];
+        it = Target_Vertex.find(Global_Point);
+        if (it == Target_Vertex.end()) continue;
+        iVertex = it->second;
+        iDonor  = Target_nDonor[iVertex];
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor, Buffer_Receive_Point[2*iRecv+1]);
+        target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor, Buffer_Receive_Coeff[iRecv]);
+        target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, jProcessor);
+        Target_nDonor[iVertex]++;
+      }
+    }
 
   }
 }
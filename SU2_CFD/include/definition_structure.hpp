@@ -35,6 +35,8 @@
 #include "../../Common/include/mpi_structure.hpp"
 
 #include <ctime>
+#include <csignal>
+#include <sys/stat.h>
 
 #include "../../Common/include/gauss_structure.hpp"
 #include "../../Common/include/element_structure.hpp"
@@ -103,3 +105,29 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
  * \param[in] config - Definition of the particular problem.
  */
 void Partition_Analysis(CGeometry *geometry, CConfig *config);
+
+/*!
+ * \brief Check the runtime control file and apply its contents to all the zones.
+ * \note The file is only parsed by the master node, and only when its modification
+ *       time has changed since the last call; the values are then broadcast to all the ranks.
+ *       The command of the first check is ignored, so that an old file does not stop a new run.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] val_nZone - Total number of zones.
+ * \param[in,out] val_mtime - Modification time of the runtime file at the last check (initialize with -1).
+ * \return Command read from the runtime file (see ENUM_RUNTIME_COMMAND), RUNTIME_CMD_NONE if unchanged.
+ */
+unsigned short Runtime_Control(CConfig **config, unsigned short val_nZone, time_t *val_mtime);
+
+/*!
+ * \brief Install the signal handlers (SIGTERM, SIGUSR1) that request a final checkpoint.
+ * \param[in] config - Definition of the particular problem.
+ */
+void Checkpoint_Preprocessing(CConfig *config);
+
+/*!
+ * \brief Check whether a wall-clock or signal triggered checkpoint is due, consistently in all the ranks.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in,out] val_lastwrite - Wall-clock time of the last checkpoint, updated when a new one is due.
+ * \return RUNTIME_CMD_STOP after a signal, RUNTIME_CMD_WRITE when the checkpoint time has elapsed, RUNTIME_CMD_NONE otherwise.
+ */
+unsigned short Checkpoint_Control(CConfig *config, time_t *val_lastwrite);
@@ -49,6 +49,34 @@ using namespace std;
 #include "../include/transport_model.hpp"
 #include "../../Common/include/config_structure.hpp"
 
+/*!
+ * \brief Position of the values of each point in the arrays of the batched evaluation of the thermodynamic state.
+ */
+enum ENUM_TDSTATE_BATCH {
+  TD_PRESSURE = 0,      /*!< \brief Pressure. */
+  TD_TEMPERATURE = 1,   /*!< \brief Temperature. */
+  TD_SOUNDSPEED2 = 2,   /*!< \brief Square of the speed of sound. */
+  TD_CP = 3,            /*!< \brief Specific heat capacity at constant pressure. */
+  TD_DPDRHO_E = 4,      /*!< \brief Derivative of the pressure with respect to the density (at constant energy). */
+  TD_DPDE_RHO = 5,      /*!< \brief Derivative of the pressure with respect to the energy (at constant density). */
+  TD_DTDRHO_E = 6,      /*!< \brief Derivative of the temperature with respect to the density (at constant energy). */
+  TD_DTDE_RHO = 7,      /*!< \brief Derivative of the temperature with respect to the energy (at constant density). */
+  N_TDSTATE = 8         /*!< \brief Number of values per point. */
+};
+
+/*!
+ * \brief Position of the values of each point in the arrays of the batched evaluation of the transport properties.
+ */
+enum ENUM_TRANSPORT_BATCH {
+  TR_VISCOSITY = 0,     /*!< \brief Laminar viscosity. */
+  TR_CONDUCTIVITY = 1,  /*!< \brief Thermal conductivity. */
+  TR_DMUDRHO_T = 2,     /*!< \brief Derivative of the viscosity with respect to the density (at constant temperature). */
+  TR_DMUDT_RHO = 3,     /*!< \brief Derivative of the viscosity with respect to the temperature (at constant density). */
+  TR_DKTDRHO_T = 4,     /*!< \brief Derivative of the conductivity with respect to the density (at constant temperature). */
+  TR_DKTDT_RHO = 5,     /*!< \brief Derivative of the conductivity with respect to the temperature (at constant density). */
+  N_TRANSPORT = 6       /*!< \brief Number of values per point. */
+};
+
 
 /*!
  * \class CFluidModel
@@ -260,6 +288,33 @@ public:
 
 		virtual void SetTDState_Ps (su2double P, su2double s );
 
+		/*!
+		 * \brief Set the Dimensionless State of an array of points using Density and Internal Energy.
+		 * \details The generic version calls SetTDState_rhoe point by point, the gas models replace it
+		 *          with a loop on their own equations without virtual calls. The model is left in the state
+		 *          of the last point.
+		 * \param[in] nState - Number of points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] e - Internal energy of the points.
+		 * \param[out] TDState - State of the points (N_TDSTATE values per point, see ENUM_TDSTATE_BATCH).
+		 */
+		virtual void SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState);
+
+		/*!
+		 * \brief Copy the current state in the layout of the batched evaluation.
+		 * \param[out] TDState - State (N_TDSTATE values, see ENUM_TDSTATE_BATCH).
+		 */
+		void GetTDState (su2double *TDState);
+
+		/*!
+		 * \brief Set the transport properties of an array of points.
+		 * \param[in] nState - Number of points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] TDState - State of the points (from SetTDState_rhoe_Batch).
+		 * \param[out] Transport - Transport properties of the points (N_TRANSPORT values per point, see ENUM_TRANSPORT_BATCH).
+		 */
+		void SetTransport_Batch (unsigned long nState, su2double *rho, su2double *TDState, su2double *Transport);
+
 };
 
 
@@ -351,6 +406,15 @@ public:
 		 */
 
 		void SetTDState_Ps (su2double P, su2double s );
+
+		/*!
+		 * \brief Set the Dimensionless State of an array of points using Density and Internal Energy.
+		 * \param[in] nState - Number of points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] e - Internal energy of the points.
+		 * \param[out] TDState - State of the points (N_TDSTATE values per point).
+		 */
+		void SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState);
 };
 
 
@@ -437,6 +501,15 @@ public:
 
 		void SetTDState_Ps (su2double P, su2double s );
 
+		/*!
+		 * \brief Set the Dimensionless State of an array of points using Density and Internal Energy.
+		 * \param[in] nState - Number of points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] e - Internal energy of the points.
+		 * \param[out] TDState - State of the points (N_TDSTATE values per point).
+		 */
+		void SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState);
+
 };
 
 
@@ -544,6 +617,228 @@ public:
 
 		void SetTDState_Ps (su2double P, su2double s );
 
+		/*!
+		 * \brief Set the Dimensionless State of an array of points using Density and Internal Energy.
+		 * \param[in] nState - Number of points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] e - Internal energy of the points.
+		 * \param[out] TDState - State of the points (N_TDSTATE values per point).
+		 */
+		void SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState);
+
+};
+
+
+/*!
+ * \derived class CLookUpTable
+ * \brief Child class for a thermodynamic model interpolated from tables generated with a real gas model.
+ * \details The state is interpolated (bilinear) from a table structured in (log(rho), e), which
+ *          stores the pressure, temperature, speed of sound, entropy and their derivatives. A second
+ *          table in (log(P), T) gives the starting point of the inverse calls, which are completed with
+ *          Newton iterations (or exact inversions along the table lines) on the first one. Outside the
+ *          tables the calls are forwarded to the model that generated them.
+ * \author: S.Vitale, G. Gori
+ * \version 4.2.0 "Cardinal"
+ */
+class CLookUpTable : public CFluidModel {
+
+protected:
+  static const unsigned short nVar_rhoe = 9;  /*!< \brief Values per node of the (rho, e) table (P, T, c2, s, dPdrho_e, dPde_rho, dTdrho_e, dTde_rho, Cp). */
+  static const unsigned short nVar_PT = 4;    /*!< \brief Values per node of the (P, T) table (rho, e, h, s). */
+
+  CFluidModel *Base_Model;         /*!< \brief Model used to generate the tables (and outside of them). */
+  unsigned short Kind_Base_Model;  /*!< \brief Kind of the base model. */
+  unsigned long nRho, nEnergy,     /*!< \brief Number of nodes of the (rho, e) table. */
+  nPress, nTemp;                   /*!< \brief Number of nodes of the (P, T) table. */
+  su2double LogRho_Min, Delta_LogRho,  /*!< \brief Density axis of the (rho, e) table (uniform in log(rho)). */
+  Energy_Min, Delta_Energy,            /*!< \brief Energy axis of the (rho, e) table. */
+  LogP_Min, Delta_LogP,                /*!< \brief Pressure axis of the (P, T) table (uniform in log(P)). */
+  Temp_Min, Delta_Temp;                /*!< \brief Temperature axis of the (P, T) table. */
+  su2double *Table_rhoe,           /*!< \brief Node values of the (rho, e) table. */
+  *Table_PT;                       /*!< \brief Node values of the (P, T) table. */
+  bool *Valid_rhoe;                /*!< \brief Nodes of the (rho, e) table with a physical state. */
+  unsigned long *First_Valid;      /*!< \brief First node of each density line from which all the nodes are valid. */
+
+  /*!
+   * \brief Kinds of the input pairs of the Newton iterations.
+   */
+  enum ENUM_LUT_PAIR {
+    PT_PAIR = 0,
+    PS_PAIR = 1,
+    HS_PAIR = 2
+  };
+
+private:
+
+  /*!
+   * \brief Generate the node values of the tables with the base model.
+   */
+  void GenerateTable(void);
+
+  /*!
+   * \brief Flag the nodes of the (rho, e) table where the base model has no physical state.
+   */
+  void SetValidity(void);
+
+  /*!
+   * \brief Read the tables from a binary file.
+   * \param[in] val_filename - Name of the file.
+   * \return <code>TRUE</code> if the file exists and was built with the same model, size and range.
+   */
+  bool ReadTable(string val_filename);
+
+  /*!
+   * \brief Write the tables to a binary file.
+   * \param[in] val_filename - Name of the file.
+   */
+  void WriteTable(string val_filename);
+
+  /*!
+   * \brief Interpolate the (rho, e) table.
+   * \param[in] rho - Density.
+   * \param[in] e - Internal energy.
+   * \param[out] val - Interpolated values.
+   * \param[out] val_drho - Derivatives of the first four interpolated values with respect to the density (if not NULL).
+   * \param[out] val_de - Derivatives of the first four interpolated values with respect to the energy (if val_drho is not NULL).
+   * \return <code>FALSE</code> if the point is outside of the table or in a cell with non physical nodes.
+   */
+  bool Interpolate_rhoe(su2double rho, su2double e, su2double *val, su2double *val_drho = NULL, su2double *val_de = NULL);
+
+  /*!
+   * \brief Interpolate the (P, T) table.
+   * \param[in] P - Pressure.
+   * \param[in] T - Temperature.
+   * \param[out] val - Interpolated values.
+   * \return <code>FALSE</code> if the point is outside of the table.
+   */
+  bool Interpolate_PT(su2double P, su2double T, su2double *val);
+
+  /*!
+   * \brief Find the energy of the (rho, e) table for a given density and pressure or temperature.
+   * \param[in] rho - Density.
+   * \param[in] val - Value of the pressure or temperature.
+   * \param[in] iVar - Index of the variable in the table (0 pressure, 1 temperature).
+   * \param[out] e - Internal energy.
+   * \return <code>FALSE</code> if the value is outside of the table.
+   */
+  bool Search_Energy(su2double rho, su2double val, unsigned short iVar, su2double &e);
+
+  /*!
+   * \brief Find the temperature of the (P, T) table for a given pressure and entropy.
+   * \param[in] P - Pressure.
+   * \param[in] s - Entropy.
+   * \param[out] T - Temperature.
+   * \return 0 if found, -1 (1) if the isentrope is below (above) the temperature range, -2 outside of the pressure range.
+   */
+  short Search_Temperature(su2double P, su2double s, su2double &T);
+
+  /*!
+   * \brief Newton iterations on the (rho, e) table for a pair of input variables.
+   * \param[in] X - First input variable.
+   * \param[in] Y - Second input variable.
+   * \param[in] val_pair - Kind of input pair.
+   * \param[in,out] rho - Density (initial guess on input).
+   * \param[in,out] e - Internal energy (initial guess on input).
+   * \param[out] val - Interpolated values at the solution.
+   * \return <code>TRUE</code> if the iterations converged inside the table.
+   */
+  bool Newton_rhoe(su2double X, su2double Y, unsigned short val_pair, su2double &rho, su2double &e, su2double *val);
+
+  /*!
+   * \brief Set the state from interpolated values of the (rho, e) table.
+   * \param[in] rho - Density.
+   * \param[in] e - Internal energy.
+   * \param[in] val - Interpolated values.
+   */
+  void SetState_Table(su2double rho, su2double e, su2double *val);
+
+  /*!
+   * \brief Copy the state of the base model.
+   */
+  void SetState_BaseModel(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CLookUpTable(void);
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] base_model - Model used to generate the tables (owned by the table).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] P_min - Lower bound of the pressure range of the tables.
+   * \param[in] P_max - Upper bound of the pressure range of the tables.
+   * \param[in] T_min - Lower bound of the temperature range of the tables.
+   * \param[in] T_max - Upper bound of the temperature range of the tables.
+   */
+  CLookUpTable(CFluidModel *base_model, CConfig *config, su2double P_min, su2double P_max,
+               su2double T_min, su2double T_max);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CLookUpTable(void);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State of an array of points using Density and Internal Energy.
+   * \param[in] nState - Number of points.
+   * \param[in] rho - Density of the points.
+   * \param[in] e - Internal energy of the points.
+   * \param[out] TDState - State of the points (N_TDSTATE values per point).
+   */
+  void SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState);
+
 };
 
 
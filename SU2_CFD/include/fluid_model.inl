@@ -44,6 +44,17 @@ inline su2double CFluidModel::GetdPde_rho () { return dPde_rho; }
 inline su2double CFluidModel::GetdTdrho_e () { return dTdrho_e; }
 inline su2double CFluidModel::GetdTde_rho () { return dTde_rho; }
 
+inline void CFluidModel::GetTDState (su2double *TDState) {
+  TDState[TD_PRESSURE]    = Pressure;
+  TDState[TD_TEMPERATURE] = Temperature;
+  TDState[TD_SOUNDSPEED2] = SoundSpeed2;
+  TDState[TD_CP]          = Cp;
+  TDState[TD_DPDRHO_E]    = dPdrho_e;
+  TDState[TD_DPDE_RHO]    = dPde_rho;
+  TDState[TD_DTDRHO_E]    = dTdrho_e;
+  TDState[TD_DTDE_RHO]    = dTde_rho;
+}
+
 inline su2double CFluidModel::GetLaminarViscosity () {
         LaminarViscosity->SetViscosity(Temperature, Density);
         Mu = LaminarViscosity->GetViscosity();
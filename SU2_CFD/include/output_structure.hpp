@@ -49,6 +49,7 @@
 #include "integration_structure.hpp"
 #include "../../Common/include/geometry_structure.hpp"
 #include "../../Common/include/config_structure.hpp"
+#include "unsteady_history_structure.hpp"
 
 using namespace std;
 
@@ -316,6 +317,59 @@ public:
 	 */
 	void SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file);
 
+  /*!
+	 * \brief Write a Paraview binary solution file, either legacy VTK (.vtk) or XML with appended raw data (.vtu).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Write the surface solution instead of the volume solution.
+	 */
+  void SetParaview_Binary(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+
+  /*!
+	 * \brief Write a Paraview binary mesh file, either legacy VTK (.vtk) or XML with appended raw data (.vtu).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Write the surface mesh instead of the volume mesh.
+   * \param[in] new_file - Write the original mesh (SU2_DEF) instead of the deformed one.
+	 */
+  void SetParaview_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file);
+
+  /*!
+	 * \brief Build the name of a Paraview output file, including zone, time instance and extension.
+	 * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Surface file instead of volume file.
+   * \param[in] mesh_file - Mesh only file (SU2_DEF).
+   * \param[in] new_file - Original mesh instead of the deformed one (SU2_DEF).
+   * \param[in] extension - File extension, including the dot.
+   * \return Name of the output file.
+	 */
+  string GetParaview_FileName(CConfig *config, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool mesh_file, bool new_file, string extension);
+
+  /*!
+	 * \brief Collect the names of the merged output variables written by the Paraview writers.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] FieldNames - Name of each output variable.
+   * \param[out] FieldIndex - Position of each output variable in the merged Data array.
+	 */
+  void SetParaview_FieldNames(CConfig *config, CGeometry *geometry, vector<string> & FieldNames, vector<unsigned short> & FieldIndex);
+
+  /*!
+	 * \brief Write the merged mesh (and solution) to a Paraview binary file using bulk buffer writes.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] filename - Name of the output file.
+   * \param[in] surf_sol - Write the surface instead of the volume.
+   * \param[in] write_data - Write the point data in addition to the mesh.
+	 */
+  void WriteParaview_Binary(CConfig *config, CGeometry *geometry, string filename, bool surf_sol, bool write_data);
+
   /*!
 	 * \brief Write a Tecplot ASCII solution file.
 	 * \param[in] geometry - Geometrical definition of the problem.
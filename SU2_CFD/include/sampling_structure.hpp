@@ -0,0 +1,148 @@
+/*!
+ * \file sampling_structure.hpp
+ * \brief Headers of the high-rate sampling of the flow solution (probes, lines, planes and surfaces).
+ *        The subroutines and functions are in the <i>sampling_structure.cpp</i> file.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *
+ * Copyright (C) 2012-2016 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../Common/include/mpi_structure.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "solver_structure.hpp"
+#include "../../Common/include/geometry_structure.hpp"
+#include "../../Common/include/config_structure.hpp"
+
+using namespace std;
+
+/*!
+ * \class CSampling
+ * \brief Sampling of the flow solution at every time step, for acoustic (FW-H) and unsteady load analyses.
+ * \details The probes, the points of the lines and planes, and the points of the sampled
+ *          surface markers are located once. Each sample is interpolated by the rank that
+ *          owns it (linear interpolation in a simplex of the element containing the point),
+ *          kept in memory and only gathered on the master node every SAMPLE_BUFFER steps,
+ *          where it is appended to a binary file.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ */
+class CSampling {
+
+protected:
+
+  unsigned short nDim,                 /*!< \brief Number of dimensions. */
+  nVar;                                /*!< \brief Number of sampled variables. */
+  unsigned long nProbe,                /*!< \brief Number of probes (points of the lines and planes included). */
+  nSample,                             /*!< \brief Total number of samples (probes and surface points). */
+  nLocal,                              /*!< \brief Number of samples interpolated by this rank. */
+  nMaxLocal,                           /*!< \brief Maximum number of samples of a rank. */
+  nBuffered;                           /*!< \brief Number of time steps in the buffer. */
+  string FileName;                     /*!< \brief Name of the sampling file. */
+
+  vector<unsigned long> Donor_Begin,   /*!< \brief First donor of each local sample (CSR storage). */
+  Donor_Point;                         /*!< \brief Donor points of the local samples. */
+  vector<su2double> Donor_Weight;      /*!< \brief Interpolation weights of the donor points. */
+  vector<unsigned long> Local_Key;     /*!< \brief Probe index, or nProbe plus the global point index, of each local sample. */
+
+  vector<passivedouble> Buffer;        /*!< \brief Values of the local samples of the buffered time steps. */
+  vector<passivedouble> Buffer_Time;   /*!< \brief Physical time of the buffered time steps. */
+  vector<unsigned long> Buffer_Iter;   /*!< \brief Iteration of the buffered time steps. */
+
+  vector<unsigned long> Sample_Position; /*!< \brief Position in the file of the gathered samples (master node). */
+
+  vector<unsigned long> Bin_Begin,     /*!< \brief First element of each bin (CSR storage). */
+  Bin_Elem;                            /*!< \brief Elements overlapping each bin. */
+  unsigned long nBin[3];               /*!< \brief Number of bins in each direction. */
+  su2double Bin_Min[3],                /*!< \brief Lower corner of the bins. */
+  Bin_Size[3];                         /*!< \brief Size of a bin in each direction. */
+
+  /*!
+   * \brief Sort the elements of the partition in a uniform grid of bins (bounding box search).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetBins(CGeometry *geometry);
+
+  /*!
+   * \brief Find the element of the partition that contains a point, and the interpolation weights.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_coord - Coordinates of the point.
+   * \param[out] val_point - Donor points.
+   * \param[out] val_weight - Interpolation weights of the donor points.
+   * \return <code>TRUE</code> if the point is inside an element of the partition.
+   */
+  bool FindElement(CGeometry *geometry, su2double *val_coord, vector<unsigned long> &val_point, vector<su2double> &val_weight);
+
+  /*!
+   * \brief Interpolation weights of a point in a simplex (triangle or tetrahedron).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_coord - Coordinates of the point.
+   * \param[in] val_node - Points of the simplex.
+   * \param[out] val_weight - Barycentric coordinates of the point.
+   * \return <code>TRUE</code> if the point is inside the simplex.
+   */
+  bool SimplexWeights(CGeometry *geometry, su2double *val_coord, unsigned long *val_node, su2double *val_weight);
+
+  /*!
+   * \brief Gather the buffered time steps on the master node and append them to the file.
+   */
+  void Flush(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, locate the samples.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CSampling(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class, write the remaining buffered time steps.
+   */
+  ~CSampling(void);
+
+  /*!
+   * \brief Interpolate the flow solution at the samples and store it in the buffer.
+   * \param[in] solver - Flow solver of the finest grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iter - Current external iteration.
+   */
+  void SetSample(CSolver *solver, CConfig *config, unsigned long val_iter);
+
+  /*!
+   * \brief Get the number of samples.
+   * \return Total number of samples.
+   */
+  unsigned long GetnSample(void);
+
+};
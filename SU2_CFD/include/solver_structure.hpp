@@ -57,6 +57,7 @@
 #include "../../Common/include/vector_structure.hpp"
 #include "../../Common/include/linear_solvers_structure.hpp"
 #include "../../Common/include/grid_movement_structure.hpp"
+#include "unsteady_history_structure.hpp"
 
 using namespace std;
 
@@ -2509,6 +2510,18 @@ public:
             						  CConfig *fea_config,
             						  CSolver ***fea_solution);
 
+	/*!
+	 * \brief A virtual member.
+	 * \param[in] fea_geometry - Geometrical definition of the problem.
+	 * \param[in] fea_config - Definition of the particular problem.
+	 * \param[in] fea_solution - Container vector with all the solutions.
+	 * \param[in] iFSIIter - FSI sub-iteration.
+	 */
+	virtual void SetIQN_Relaxation(CGeometry **fea_geometry,
+            					   CConfig *fea_config,
+            					   CSolver ***fea_solution,
+            					   unsigned long iFSIIter);
+
 	/*!
 	 * \brief A virtual member.
 	 * \param[in] fea_geometry - Geometrical definition of the problem.
@@ -3062,6 +3075,10 @@ protected:
   unsigned long AoA_Counter;
 
   CFluidModel  *FluidModel;  /*!< \brief fluid model used in the solver */
+  su2double *Batch_Density,  /*!< \brief Density of the points for the batched evaluation of the fluid model. */
+  *Batch_Energy,             /*!< \brief Internal energy of the points for the batched evaluation of the fluid model. */
+  *Batch_TDState,            /*!< \brief Thermodynamic state of the points (N_TDSTATE values per point). */
+  *Batch_Transport;          /*!< \brief Transport properties of the points (N_TRANSPORT values per point). */
   su2double **AveragedVelocity,
   	  	 **AveragedNormal,
 		 **AveragedGridVel,
@@ -6801,6 +6818,10 @@ private:
 	su2double WAitken_Dyn;				/*!< \brief Aitken's dynamic coefficient */
 	su2double WAitken_Dyn_tn1;			/*!< \brief Aitken's dynamic coefficient in the previous iteration */
 
+	vector<vector<su2double> > IQN_V,	/*!< \brief Differences of the interface residuals of the quasi-Newton method (newest first). */
+	IQN_W;								/*!< \brief Differences of the structural solutions of the quasi-Newton method (newest first). */
+	vector<unsigned long> IQN_TimeIter;	/*!< \brief Time iteration of each secant pair of the quasi-Newton method. */
+
 	CSysMatrix MassMatrix; 			/*!< \brief Sparse structure for storing the mass matrix. */
 	CSysVector TimeRes_Aux;			/*!< \brief Auxiliary vector for adding mass and damping contributions to the residual. */
 	CSysVector TimeRes;				/*!< \brief Vector for adding mass and damping contributions to the residual */
@@ -7199,6 +7220,20 @@ public:
             				  CConfig *fea_config,
             				  CSolver ***fea_solution);
 
+	/*!
+	 * \brief Interface quasi-Newton update of the predicted solution (IQN-ILS): the inverse of the
+	 *        Jacobian of the interface residual is modelled by least squares on the differences
+	 *        of the residuals and of the structural solutions of the previous sub-iterations.
+	 * \param[in] fea_geometry - Geometrical definition of the problem.
+	 * \param[in] fea_config - Definition of the particular problem.
+	 * \param[in] fea_solution - Container vector with all the solutions.
+	 * \param[in] iFSIIter - FSI sub-iteration.
+	 */
+	void SetIQN_Relaxation(CGeometry **fea_geometry,
+            			   CConfig *fea_config,
+            			   CSolver ***fea_solution,
+            			   unsigned long iFSIIter);
+
 	/*!
 	 * \brief Aitken's relaxation of the solution.
 	 * \param[in] fea_geometry - Geometrical definition of the problem.
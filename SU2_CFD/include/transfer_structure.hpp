@@ -40,6 +40,8 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <vector>
+#include <map>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -50,6 +52,54 @@
 
 using namespace std;
 
+/*!
+ * \class CTransferOperator
+ * \brief Sparse transfer operator of one interface marker, built from the interpolation coefficients
+ *        stored in the target vertices. Each processor receives only the donor values it needs.
+ * \version 4.0.1 "Cardinal"
+ */
+
+class CTransferOperator {
+public:
+
+	int Marker_Donor,					/*!< \brief Local index of the donor marker (-1 if not in this processor). */
+	Marker_Target;						/*!< \brief Local index of the target marker (-1 if not in this processor). */
+
+	vector<unsigned long> Donor_Vertex;	/*!< \brief Local donor vertices whose values are sent (each of them once). */
+	vector<int> Send_Proc;				/*!< \brief Processors that receive donor values from this processor. */
+	vector<unsigned long> Send_Index,	/*!< \brief Index of the first value sent to each processor of Send_Proc. */
+	Send_Slot;							/*!< \brief Position in Donor_Vertex of each value sent. */
+
+	vector<int> Recv_Proc;				/*!< \brief Processors that send donor values to this processor. */
+	vector<unsigned long> Recv_Index;	/*!< \brief Index of the first value received from each processor of Recv_Proc. */
+
+	vector<unsigned long> Target_Vertex,/*!< \brief Local target vertices (owned by this processor). */
+	Target_Index,						/*!< \brief Index of the first donor of each target vertex. */
+	Target_Slot;						/*!< \brief Position of each donor value in the receive buffer. */
+	vector<su2double> Target_Coeff;		/*!< \brief Interpolation coefficient of each donor. */
+
+	/*!
+	 * \brief Constructor of the class.
+	 */
+	CTransferOperator(void);
+
+	/*!
+	 * \brief Destructor of the class.
+	 */
+	~CTransferOperator(void);
+
+	/*!
+	 * \brief Build the communication pattern and the coefficients of the operator.
+	 * \param[in] donor_geometry - Geometry of the donor mesh.
+	 * \param[in] target_geometry - Geometry of the target mesh.
+	 * \param[in] val_marker_donor - Local index of the donor marker (-1 if not in this processor).
+	 * \param[in] val_marker_target - Local index of the target marker (-1 if not in this processor).
+	 */
+	void SetOperator(CGeometry *donor_geometry, CGeometry *target_geometry,
+					 int val_marker_donor, int val_marker_target);
+
+};
+
 /*!
  * \class CTransfer
  * \brief Main class for defining the physical transfer of information.
@@ -66,6 +116,8 @@ protected:
 
 	unsigned short nVar;
 
+	vector<CTransferOperator> Sparse_Operator;	/*!< \brief Sparse transfer operators of the interface markers (built on first use). */
+
 public:
 	/*!
 	 * \brief Constructor of the class.
@@ -137,6 +189,20 @@ public:
    	   	   	   	   	 	 	 	 	 CGeometry *donor_geometry, CGeometry *target_geometry,
 									 CConfig *donor_config, CConfig *target_config);
 
+	/*!
+	 * \brief Interpolate data with a precomputed sparse operator, for nonmatching meshes: each processor
+	 *        only receives the donor values that its target points need.
+	 * \param[in] donor_solution - Solution from the donor mesh.
+	 * \param[in] target_solution - Solution from the target mesh.
+	 * \param[in] donor_geometry - Geometry of the donor mesh.
+	 * \param[in] target_geometry - Geometry of the target mesh.
+	 * \param[in] donor_config - Definition of the problem at the donor mesh.
+	 * \param[in] target_config - Definition of the problem at the target mesh.
+	 */
+	void Sparse_InterfaceData(CSolver *donor_solution, CSolver *target_solution,
+							  CGeometry *donor_geometry, CGeometry *target_geometry,
+							  CConfig *donor_config, CConfig *target_config);
+
 	/*!
 	 * \brief A virtual member.
 	 */
@@ -0,0 +1,127 @@
+/*!
+ * \file unsteady_history_structure.hpp
+ * \brief Headers of the container for the unsteady solution history.
+ *        The subroutines and functions are in the <i>unsteady_history_structure.cpp</i> file.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *
+ * Copyright (C) 2012-2016 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../Common/include/mpi_structure.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <map>
+
+#include "../../Common/include/config_structure.hpp"
+
+using namespace std;
+
+/*!
+ * \class CUnsteadyHistory
+ * \brief Single file container for the restart files of an unsteady simulation.
+ * \details Each time step is stored as a binary record (header line of the restart
+ *          file plus the values, variable by variable). The values can be byte shuffled
+ *          and compressed with zlib, and optionally rounded to a relative tolerance before
+ *          the compression. An index at the end of the file gives random access by time step,
+ *          so that the unsteady adjoint can read the history backwards. A record is read back
+ *          as the text of the equivalent restart file, so the usual parsers can be used.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ */
+class CUnsteadyHistory {
+
+protected:
+
+  string FileName;                   /*!< \brief Name of the container file. */
+  unsigned short Kind_Compression;   /*!< \brief Compression of the new records (see ENUM_HISTORY_COMPRESSION). */
+  unsigned short nMantissa_Bits;     /*!< \brief Mantissa bits kept by the lossy compression. */
+  map<long, unsigned long> Index;    /*!< \brief Position of the record of each time step in the file. */
+  unsigned long Index_Position;      /*!< \brief Position of the index (end of the last record). */
+
+  /*!
+   * \brief Read the index at the end of the file, or rebuild it from the records if it is damaged.
+   * \return <code>TRUE</code> if the file exists and contains a valid container.
+   */
+  bool ReadIndex(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file (without the time step).
+   * \param[in] val_iter - Time step, used to select the container when it is split every UNSTEADY_HISTORY_STEPS.
+   */
+  CUnsteadyHistory(CConfig *config, string val_filename, long val_iter);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CUnsteadyHistory(void);
+
+  /*!
+   * \brief Get the name of the container file.
+   * \return Name of the container file.
+   */
+  string GetFileName(void);
+
+  /*!
+   * \brief Append the restart data of a time step to the container (master node only).
+   * \param[in] val_iter - Time step of the record.
+   * \param[in] val_header - Header line of the restart file.
+   * \param[in] val_coord - Coordinates of the points [nDim][nPoint].
+   * \param[in] val_nDim - Number of dimensions.
+   * \param[in] val_data - Values of the variables [nVar][nPoint].
+   * \param[in] val_nVar - Number of variables.
+   * \param[in] val_nPoint - Number of points.
+   * \return <code>TRUE</code> if the record has been written.
+   */
+  bool WriteRecord(long val_iter, string val_header, su2double **val_coord, unsigned short val_nDim,
+                   su2double **val_data, unsigned short val_nVar, unsigned long val_nPoint);
+
+  /*!
+   * \brief Read the record of a time step as the text of the equivalent restart file.
+   * \param[in] val_iter - Time step of the record.
+   * \param[out] val_record - Text of the restart file.
+   * \return <code>TRUE</code> if the record exists and has been read.
+   */
+  bool ReadRecord(long val_iter, stringstream &val_record);
+
+  /*!
+   * \brief Read the restart of a time step from the unsteady history, throw an error if this fails.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file (without the time step).
+   * \param[in] val_iter - Time step of the restart.
+   * \param[out] val_record - Text of the restart file.
+   */
+  static void ReadRestart(CConfig *config, string val_filename, long val_iter, stringstream &val_record);
+
+};
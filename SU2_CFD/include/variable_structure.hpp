@@ -1056,13 +1056,16 @@ public:
 
 	/*!
 	 * \brief A virtual member.
+	 * \param[in] TDState - Thermodynamic state of the point (from the batched evaluation of the fluid model).
+	 * \param[in] FluidModel - Fluid model, used again only for the non physical points.
 	 */
-	 virtual bool SetPrimVar_Compressible(CFluidModel *FluidModel);
+	 virtual bool SetPrimVar_Compressible(su2double *TDState, CFluidModel *FluidModel);
 
 	/*!
      * \brief A virtual member.
+	 * \param[in] TDState - Thermodynamic state of the point.
 	 */
-     virtual void SetSecondaryVar_Compressible(CFluidModel *FluidModel);
+     virtual void SetSecondaryVar_Compressible(su2double *TDState);
 
   /*!
 	 * \brief A virtual member.
@@ -1097,8 +1100,20 @@ public:
 	
 	/*!
 	 * \brief A virtual member.
+	 * \param[in] eddy_visc - Eddy viscosity.
+	 * \param[in] turb_ke - Turbulent kinetic energy.
+	 * \param[in] TDState - Thermodynamic state of the point (from the batched evaluation of the fluid model).
+	 * \param[in] Transport - Transport properties of the point (from the batched evaluation of the fluid model).
+	 * \param[in] FluidModel - Fluid model, used again only for the non physical points.
 	 */		
-	virtual bool SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel);
+	virtual bool SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, su2double *TDState, su2double *Transport, CFluidModel *FluidModel);
+
+	/*!
+	 * \brief A virtual member.
+	 * \param[in] TDState - Thermodynamic state of the point.
+	 * \param[in] Transport - Transport properties of the point.
+	 */
+	virtual void SetSecondaryVar_Compressible(su2double *TDState, su2double *Transport);
 
 	/*!
 	 * \brief A virtual member.
@@ -2946,14 +2961,19 @@ public:
 
 	/*!
 	 * \brief Set all the primitive variables for compressible flows.
+	 * \details The velocity must have been set before (SetVelocity).
+	 * \param[in] TDState - Thermodynamic state of the point (from the batched evaluation of the fluid model).
+	 * \param[in] FluidModel - Fluid model, used again only for the non physical points.
 	 */
-	bool SetPrimVar_Compressible(CFluidModel *FluidModel);
+	bool SetPrimVar_Compressible(su2double *TDState, CFluidModel *FluidModel);
   using CVariable::SetPrimVar_Compressible;
   
 	/*!
-	 * \brief A virtual member.
+	 * \brief Set all the secondary variables (partial derivatives) for compressible flows.
+	 * \param[in] TDState - Thermodynamic state of the point.
 	 */
-	void SetSecondaryVar_Compressible(CFluidModel *FluidModel);
+	void SetSecondaryVar_Compressible(su2double *TDState);
+  using CVariable::SetSecondaryVar_Compressible;
 
 	/*!
 	 * \brief Set all the primitive variables for incompressible flows.
@@ -3387,14 +3407,23 @@ public:
   
   /*!
    * \brief Set all the primitive variables for compressible flows
+   * \details The velocity must have been set before (SetVelocity).
+   * \param[in] eddy_visc - Eddy viscosity.
+   * \param[in] turb_ke - Turbulent kinetic energy.
+   * \param[in] TDState - Thermodynamic state of the point (from the batched evaluation of the fluid model).
+   * \param[in] Transport - Transport properties of the point (from the batched evaluation of the fluid model).
+   * \param[in] FluidModel - Fluid model, used again only for the non physical points.
    */
-  bool SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel);
+  bool SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, su2double *TDState, su2double *Transport, CFluidModel *FluidModel);
   using CVariable::SetPrimVar_Compressible;
   
 	/*!
 	 * \brief Set all the secondary variables (partial derivatives) for compressible flows
+	 * \param[in] TDState - Thermodynamic state of the point.
+	 * \param[in] Transport - Transport properties of the point.
 	 */
-	void SetSecondaryVar_Compressible(CFluidModel *FluidModel);
+	void SetSecondaryVar_Compressible(su2double *TDState, su2double *Transport);
+  using CVariable::SetSecondaryVar_Compressible;
 
 	/*!
 	 * \brief Set all the primitive variables for incompressible flows
@@ -323,13 +323,15 @@ inline bool CVariable::SetPrimVar_FreeSurface(su2double SharpEdge_Distance, bool
 
 inline bool CVariable::SetPrimVar_Compressible(CConfig *config) { return true; }
 
-inline bool CVariable::SetPrimVar_Compressible(CFluidModel *FluidModel) { return true; }
+inline bool CVariable::SetPrimVar_Compressible(su2double *TDState, CFluidModel *FluidModel) { return true; }
 
-inline void CVariable::SetSecondaryVar_Compressible(CFluidModel *FluidModel) { }
+inline void CVariable::SetSecondaryVar_Compressible(su2double *TDState) { }
 
 inline bool CVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, CConfig *config) { return true; }
 
-inline bool CVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) { return true; }
+inline bool CVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, su2double *TDState, su2double *Transport, CFluidModel *FluidModel) { return true; }
+
+inline void CVariable::SetSecondaryVar_Compressible(su2double *TDState, su2double *Transport) { }
 
 inline bool CVariable::SetPrimVar_Incompressible(su2double Density_Inf, CConfig *config) { return true; }
 
@@ -38,9 +38,10 @@ int main(int argc, char *argv[]) {
   bool StopCalc = false;
   su2double StartTime = 0.0, StopTime = 0.0, UsedTime = 0.0;
   unsigned long ExtIter = 0;
-  unsigned short iMesh, iZone, nZone, nDim;
+  unsigned short iMesh, iZone, nZone, nDim, RuntimeCommand = RUNTIME_CMD_NONE;
+  unsigned short CheckpointCommand = RUNTIME_CMD_NONE, CheckpointPending = RUNTIME_CMD_NONE;
   char config_file_name[MAX_STRING_SIZE];
-  char runtime_file_name[MAX_STRING_SIZE];
+  time_t RuntimeFile_Time = (time_t)(-1), Checkpoint_Time = time(NULL);
   ofstream ConvHist_file;
   int rank = MASTER_NODE;
   int size = SINGLE_NODE;
@@ -63,6 +64,7 @@ int main(int argc, char *argv[]) {
   CDriver *driver                         = NULL;
   CIteration **iteration_container        = NULL;
   COutput *output                         = NULL;
+  CSampling *sampling                     = NULL;
   CIntegration ***integration_container   = NULL;
   CGeometry ***geometry_container         = NULL;
   CSolver ****solver_container            = NULL;
@@ -282,6 +284,19 @@ int main(int argc, char *argv[]) {
   
   output = new COutput();
   
+  /*--- Sampling of the flow solution at probes, lines, planes and surface
+   markers, every SAMPLE_FREQ iterations (FW-H and unsteady load analyses). ---*/
+  
+  if (config_container[ZONE_0]->GetSampling()) {
+    switch (config_container[ZONE_0]->GetKind_Solver()) {
+      case EULER: case NAVIER_STOKES: case RANS:
+        sampling = new CSampling(geometry_container[ZONE_0][MESH_0], config_container[ZONE_0]); break;
+      default:
+        if (rank == MASTER_NODE) cout << "WARNING: The sampling is only available for the flow solvers." << endl;
+        break;
+    }
+  }
+  
   /*--- Open the convergence history file ---*/
   
   if (rank == MASTER_NODE)
@@ -301,6 +316,11 @@ int main(int argc, char *argv[]) {
   	for (iZone = 0; iZone < nZone; iZone++)
   	  iteration_container[iZone]->Preprocess(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone);
 
+  /*--- Signals sent by the batch scheduler before the wall-time limit
+   request a final checkpoint ---*/
+  
+  Checkpoint_Preprocessing(config_container[ZONE_0]);
+  
   /*--- Main external loop of the solver. Within this loop, each iteration ---*/
   
   if (rank == MASTER_NODE)
@@ -366,6 +386,12 @@ int main(int argc, char *argv[]) {
     
     UsedTime = (StopTime - StartTime);
     
+    /*--- Sample the flow solution (the samples are buffered in memory and
+     written every SAMPLE_BUFFER samples). ---*/
+    
+    if (sampling != NULL)
+      sampling->SetSample(solver_container[ZONE_0][MESH_0][FLOW_SOL], config_container[ZONE_0], ExtIter);
+    
     /*--- For specific applications, evaluate and plot the equivalent area. ---*/
     
     if (config_container[ZONE_0]->GetEquivArea() == YES) {
@@ -373,12 +399,10 @@ int main(int argc, char *argv[]) {
                                 geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], ExtIter);
     }
     
-    /*--- Check if there is any change in the runtime parameters ---*/
+    /*--- Check if there is any change in the runtime parameters. The file
+     is only parsed again when it has been modified. ---*/
     
-    CConfig *runtime = NULL;
-    strcpy(runtime_file_name, "runtime.dat");
-    runtime = new CConfig(runtime_file_name, config_container[ZONE_0]);
-    runtime->SetExtIter(ExtIter);
+    RuntimeCommand = Runtime_Control(config_container, nZone, &RuntimeFile_Time);
     
 	/*--- Update the convergence history file (serial and parallel computations). ---*/
 
@@ -412,6 +436,29 @@ int main(int argc, char *argv[]) {
         StopCalc = integration_container[ZONE_0][ADJFLOW_SOL]->GetConvergence(); break;
     }
     
+    /*--- The runtime file can also stop the simulation (after writing the solution) ---*/
+    
+    if (RuntimeCommand == RUNTIME_CMD_STOP) StopCalc = true;
+    
+    /*--- Wall-clock and signal triggered checkpoints. Second order dual time
+     stepping restarts from two consecutive physical time steps, so the
+     checkpoint is written now and again after the next time step. ---*/
+    
+    CheckpointCommand = Checkpoint_Control(config_container[ZONE_0], &Checkpoint_Time);
+    
+    if (config_container[ZONE_0]->GetUnsteady_Simulation() == DT_STEPPING_2ND) {
+      if (CheckpointPending != RUNTIME_CMD_NONE) {
+        if (CheckpointCommand != RUNTIME_CMD_STOP) CheckpointCommand = CheckpointPending;
+        CheckpointPending = RUNTIME_CMD_NONE;
+      }
+      else if (CheckpointCommand != RUNTIME_CMD_NONE) {
+        CheckpointPending = CheckpointCommand;
+        CheckpointCommand = RUNTIME_CMD_WRITE;
+      }
+    }
+    
+    if (CheckpointCommand == RUNTIME_CMD_STOP) StopCalc = true;
+    
 		/*--- Solution output. Determine whether a solution needs to be written
 		 after the current iteration, and if so, execute the output file writing
 		 routines. ---*/
@@ -427,7 +474,7 @@ int main(int argc, char *argv[]) {
 				
 				||
 				
-				(StopCalc)
+				(StopCalc) || (RuntimeCommand == RUNTIME_CMD_WRITE) || (CheckpointCommand != RUNTIME_CMD_NONE)
 				
 				||
 				
@@ -495,6 +542,10 @@ int main(int argc, char *argv[]) {
     
   }
   
+  /*--- Write the remaining samples ---*/
+  
+  if (sampling != NULL) delete sampling;
+  
   /*--- Output some information to the console. ---*/
   
   if (rank == MASTER_NODE) {
@@ -500,3 +500,141 @@ void Partition_Analysis(CGeometry *geometry, CConfig *config) {
   delete [] isHalo;
   
 }
+
+unsigned short Runtime_Control(CConfig **config, unsigned short val_nZone, time_t *val_mtime) {
+  
+  unsigned short iZone, command = RUNTIME_CMD_NONE;
+  su2double Buffer[4] = {0.0, 0.0, 0.0, 0.0};
+  bool first_check = (*val_mtime == (time_t)(-1)), file_found = false;
+  char runtime_file_name[MAX_STRING_SIZE];
+  struct stat file_stat;
+  CConfig *runtime = NULL;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Only the master node looks at the file system, and the file is only
+   parsed again when its modification time has changed ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    strcpy(runtime_file_name, config[ZONE_0]->GetRuntime_FileName().c_str());
+    
+    file_found = (stat(runtime_file_name, &file_stat) == 0);
+    
+    if (file_found && (file_stat.st_mtime != *val_mtime)) {
+      
+      *val_mtime = file_stat.st_mtime;
+      
+      /*--- Parameters that are not present in the file are zero (unchanged) ---*/
+      
+      runtime = new CConfig(runtime_file_name, config[ZONE_0]);
+      if (!first_check) command = runtime->GetRuntime_Command();
+      
+      Buffer[1] = su2double(runtime->GetnExtIter());
+      Buffer[2] = runtime->GetCFL_FineGrid();
+      Buffer[3] = su2double(command);
+      if ((Buffer[1] > 0.0) || (Buffer[2] > 0.0) || (command != RUNTIME_CMD_NONE)) Buffer[0] = 1.0;
+      
+      delete runtime;
+      
+    }
+    
+    /*--- A missing file is treated as a file that was never seen, so that
+     a file created later is always applied, including its command ---*/
+    
+    if (!file_found) *val_mtime = 0;
+    
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(Buffer, 4, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Nothing has changed ---*/
+  
+  if (Buffer[0] == 0.0) return RUNTIME_CMD_NONE;
+  
+  /*--- Apply the parameters to all the zones in all the ranks ---*/
+  
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+    if (Buffer[1] > 0.0) config[iZone]->SetnExtIter((unsigned long)SU2_TYPE::Int(Buffer[1]));
+    if (Buffer[2] > 0.0) config[iZone]->SetCFL_FineGrid(Buffer[2]);
+  }
+  
+  command = (unsigned short)SU2_TYPE::Int(Buffer[3]);
+  
+  if ((rank == MASTER_NODE) && (!first_check)) {
+    cout << endl << "Runtime file " << config[ZONE_0]->GetRuntime_FileName() << " updated: ";
+    cout << "EXT_ITER= " << config[ZONE_0]->GetnExtIter() << ", CFL_NUMBER= " << config[ZONE_0]->GetCFL_FineGrid();
+    if (command == RUNTIME_CMD_STOP)  cout << ", stopping the simulation.";
+    if (command == RUNTIME_CMD_WRITE) cout << ", writing the solution files.";
+    cout << endl;
+  }
+  
+  return command;
+  
+}
+
+/*--- Flag raised by the signal handler, only checked between iterations ---*/
+
+static volatile sig_atomic_t Checkpoint_SignalCaught = 0;
+
+static void Checkpoint_SignalHandler(int val_signal) {
+  Checkpoint_SignalCaught = 1;
+}
+
+void Checkpoint_Preprocessing(CConfig *config) {
+  
+  if (!config->GetCheckpoint_Signal()) return;
+  
+  signal(SIGTERM, Checkpoint_SignalHandler);
+  signal(SIGUSR1, Checkpoint_SignalHandler);
+  
+}
+
+unsigned short Checkpoint_Control(CConfig *config, time_t *val_lastwrite) {
+  
+  unsigned short command = RUNTIME_CMD_NONE;
+  su2double WallTime = config->GetWrt_Sol_WallTime();
+  int Local[2] = {0, 0}, Global[2] = {0, 0};
+  time_t CurrentTime;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  if ((!config->GetCheckpoint_Signal()) && (WallTime <= 0.0)) return RUNTIME_CMD_NONE;
+  
+  /*--- The signal may only reach some of the ranks, and the clock of the
+   master node decides for the wall-clock checkpoints ---*/
+  
+  Local[0] = int(Checkpoint_SignalCaught);
+  if ((rank == MASTER_NODE) && (WallTime > 0.0)) {
+    CurrentTime = time(NULL);
+    if (difftime(CurrentTime, *val_lastwrite) >= 60.0*SU2_TYPE::GetValue(WallTime)) {
+      *val_lastwrite = CurrentTime;
+      Local[1] = 1;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(Local, Global, 2, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#else
+  Global[0] = Local[0]; Global[1] = Local[1];
+#endif
+  
+  if (Global[1] == 1) command = RUNTIME_CMD_WRITE;
+  if (Global[0] == 1) command = RUNTIME_CMD_STOP;
+  
+  if (rank == MASTER_NODE) {
+    if (command == RUNTIME_CMD_WRITE) cout << endl << "Wall-clock checkpoint, writing the solution files." << endl;
+    if (command == RUNTIME_CMD_STOP)  cout << endl << "Signal received, writing the solution files and stopping the simulation." << endl;
+  }
+  
+  return command;
+  
+}
@@ -1773,8 +1773,15 @@ void CDriver::Interface_Preprocessing(CTransfer ***transfer_container, CInterpol
 					geometry_container[donorZone][MESH_0]->MatchZone(config_container[donorZone], geometry_container[targetZone][MESH_0],
 							config_container[targetZone], donorZone, nZone);
 				}
+				/*--- Conservative load transfer: transpose of the interpolation of the displacements ---*/
+				else if (config_container[donorZone]->GetConservativeInterpolation() && structural_target && targetZone > donorZone){
+					interpolator_container[donorZone][targetZone] = new CMirror(geometry_container, config_container, donorZone, targetZone);
+					if (rank == MASTER_NODE) cout << "using a mirror approach: transpose of the coefficients from the opposite mesh." << endl;
+				}
 				/*--- Else: interpolate ---*/
 				else {
+          if (config_container[donorZone]->GetConservativeInterpolation() && structural_target && rank == MASTER_NODE)
+            cout << "Conservative interpolation assumes the structure model mesh is evaluated second. The coefficients will be calculated for both meshes, and the transfer is not conservative." << endl;
           switch (config_container[donorZone]->GetKindInterpolation()){
             case NEAREST_NEIGHBOR:
               interpolator_container[donorZone][targetZone] = new CNearestNeighbor(geometry_container, config_container, donorZone, targetZone);
@@ -1784,6 +1791,14 @@ void CDriver::Interface_Preprocessing(CTransfer ***transfer_container, CInterpol
               interpolator_container[donorZone][targetZone] = new CIsoparametric(geometry_container, config_container, donorZone, targetZone);
               if (rank == MASTER_NODE) cout << "using an isoparametric approach." << endl;
               break;
+            case RADIAL_BASIS_FUNCTION:
+              interpolator_container[donorZone][targetZone] = new CRadialBasisFunction(geometry_container, config_container, donorZone, targetZone);
+              if (rank == MASTER_NODE) cout << "using a radial basis function approach." << endl;
+              break;
+            case MORTAR:
+              interpolator_container[donorZone][targetZone] = new CMortar(geometry_container, config_container, donorZone, targetZone);
+              if (rank == MASTER_NODE) cout << "using a mortar approach." << endl;
+              break;
             case CONSISTCONSERVE:
               if (targetZone>0 && structural_target){
                 interpolator_container[donorZone][targetZone] = new CMirror(geometry_container, config_container, donorZone, targetZone);
@@ -2489,8 +2504,8 @@ void CFSIDriver::Run(CIteration **iteration_container,
 	unsigned long FSIIter = 0; for (iZone = 0; iZone < nZone; iZone++) config_container[iZone]->SetFSIIter(FSIIter);
 	unsigned long nFSIIter = config_container[ZONE_FLOW]->GetnIterFSI();
 
-#ifdef HAVE_MPI
   int rank = MASTER_NODE;
+#ifdef HAVE_MPI
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
 
@@ -2592,6 +2607,11 @@ void CFSIDriver::Run(CIteration **iteration_container,
 
 	}
 
+	/*--- Number of FSI sub-iterations of this time step ---*/
+
+	if (rank == MASTER_NODE)
+		cout << "FSI sub-iterations in time step " << ExtIter << ": " << min(FSIIter+1, nFSIIter) << "." << endl;
+
 	/*-----------------------------------------------------------------*/
   	/*------------------ Update coupled solver ------------------------*/
 	/*-----------------------------------------------------------------*/
@@ -2713,6 +2733,17 @@ void CFSIDriver::Transfer_Displacements(COutput *output, CIntegration ***integra
 //			grid_movement[targetZone]->SetVolume_Deformation(geometry_container[targetZone][MESH_0], config_container[targetZone], true);
 		}
 		break;
+	case SPARSE_DATA:
+		if (MatchingMesh){
+			cout << "Sparse method not implemented for matching meshes. Exiting..." << endl;
+			exit(EXIT_FAILURE);
+		}
+		else {
+			transfer_container[donorZone][targetZone]->Sparse_InterfaceData(solver_container[donorZone][MESH_0][FEA_SOL],solver_container[targetZone][MESH_0][FLOW_SOL],
+					geometry_container[donorZone][MESH_0],geometry_container[targetZone][MESH_0],
+					config_container[donorZone], config_container[targetZone]);
+		}
+		break;
 	case LEGACY_METHOD:
 		if (MatchingMesh){
 			solver_container[targetZone][MESH_0][FLOW_SOL]->SetFlow_Displacement(geometry_container[targetZone], grid_movement[targetZone],
@@ -2786,6 +2817,17 @@ void CFSIDriver::Transfer_Tractions(COutput *output, CIntegration ***integration
 					config_container[donorZone], config_container[targetZone]);
 		}
 		break;
+	case SPARSE_DATA:
+		if (MatchingMesh){
+			cout << "Sparse method not implemented for matching meshes. Exiting..." << endl;
+			exit(EXIT_FAILURE);
+		}
+		else {
+			transfer_container[donorZone][targetZone]->Sparse_InterfaceData(solver_container[donorZone][MESH_0][FLOW_SOL],solver_container[targetZone][MESH_0][FEA_SOL],
+					geometry_container[donorZone][MESH_0],geometry_container[targetZone][MESH_0],
+					config_container[donorZone], config_container[targetZone]);
+		}
+		break;
 	case LEGACY_METHOD:
 		if (MatchingMesh){
 			solver_container[targetZone][MESH_0][FEA_SOL]->SetFEA_Load(solver_container[donorZone], geometry_container[targetZone], geometry_container[donorZone],
@@ -2808,17 +2850,29 @@ void CFSIDriver::Relaxation_Displacements(COutput *output, CGeometry ***geometry
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
 
-	/*-------------------- Aitken's relaxation ------------------------*/
+	/*------------------ Interface quasi-Newton ----------------------*/
 
-	/*------------------- Compute the coefficient ---------------------*/
+	if (config_container[donorZone]->GetRelaxation_Method_FSI() == IQN_ILS){
 
-	solver_container[donorZone][MESH_0][FEA_SOL]->ComputeAitken_Coefficient(geometry_container[donorZone], config_container[donorZone],
-			solver_container[donorZone], FSIIter);
+		solver_container[donorZone][MESH_0][FEA_SOL]->SetIQN_Relaxation(geometry_container[donorZone], config_container[donorZone],
+				solver_container[donorZone], FSIIter);
 
-	/*----------------- Set the relaxation parameter ------------------*/
+	}
+	else{
 
-	solver_container[donorZone][MESH_0][FEA_SOL]->SetAitken_Relaxation(geometry_container[donorZone], config_container[donorZone],
-			solver_container[donorZone]);
+		/*-------------------- Aitken's relaxation ------------------------*/
+
+		/*------------------- Compute the coefficient ---------------------*/
+
+		solver_container[donorZone][MESH_0][FEA_SOL]->ComputeAitken_Coefficient(geometry_container[donorZone], config_container[donorZone],
+				solver_container[donorZone], FSIIter);
+
+		/*----------------- Set the relaxation parameter ------------------*/
+
+		solver_container[donorZone][MESH_0][FEA_SOL]->SetAitken_Relaxation(geometry_container[donorZone], config_container[donorZone],
+				solver_container[donorZone]);
+
+	}
 
 
 	/*----------------- Communicate the predicted solution and the old one ------------------*/
@@ -84,3 +84,42 @@ void CFluidModel::SetThermalConductivityModel (CConfig *config) {
   
 }
 
+void CFluidModel::SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState) {
+  
+  unsigned long iState;
+  
+  for (iState = 0; iState < nState; iState++) {
+    SetTDState_rhoe(rho[iState], e[iState]);
+    GetTDState(&TDState[iState*N_TDSTATE]);
+  }
+  
+}
+
+void CFluidModel::SetTransport_Batch (unsigned long nState, su2double *rho, su2double *TDState, su2double *Transport) {
+  
+  unsigned long iState;
+  su2double T, Cp_State, *State_Transport;
+  
+  for (iState = 0; iState < nState; iState++) {
+    
+    T = TDState[iState*N_TDSTATE+TD_TEMPERATURE];
+    Cp_State = TDState[iState*N_TDSTATE+TD_CP];
+    State_Transport = &Transport[iState*N_TRANSPORT];
+    
+    /*--- Same sequence of calls as GetLaminarViscosity and GetThermalConductivity ---*/
+    
+    LaminarViscosity->SetViscosity(T, rho[iState]);
+    State_Transport[TR_VISCOSITY] = LaminarViscosity->GetViscosity();
+    LaminarViscosity->SetDerViscosity(T, rho[iState]);
+    State_Transport[TR_DMUDRHO_T] = LaminarViscosity->Getdmudrho_T();
+    State_Transport[TR_DMUDT_RHO] = LaminarViscosity->GetdmudT_rho();
+    
+    ThermalConductivity->SetConductivity(T, rho[iState], State_Transport[TR_VISCOSITY], Cp_State);
+    State_Transport[TR_CONDUCTIVITY] = ThermalConductivity->GetConductivity();
+    ThermalConductivity->SetDerConductivity(T, rho[iState], State_Transport[TR_DMUDRHO_T], State_Transport[TR_DMUDT_RHO], Cp_State);
+    State_Transport[TR_DKTDRHO_T] = ThermalConductivity->Getdktdrho_T();
+    State_Transport[TR_DKTDT_RHO] = ThermalConductivity->GetdktdT_rho();
+    
+  }
+  
+}
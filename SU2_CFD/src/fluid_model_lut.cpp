@@ -0,0 +1,643 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the look-up table thermodynamic model.
+ * \author S. Vitale, G. Gori, M. Pini, A. Guardone, P. Colonna
+ * \version 4.2.0 "Cardinal"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *
+ * Copyright (C) 2012-2016 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./../include/fluid_model.hpp"
+
+/*--- Tag at the beginning of a table file (format version in the last two characters) ---*/
+
+static const char LUT_FileTag[8] = {'S', 'U', '2', '_', 'L', 'U', '0', '1'};
+
+CLookUpTable::CLookUpTable() : CFluidModel() {
+
+  Base_Model = NULL;
+  Table_rhoe = NULL; Table_PT = NULL;
+  Valid_rhoe = NULL; First_Valid = NULL;
+  nRho = 0; nEnergy = 0; nPress = 0; nTemp = 0;
+  LogRho_Min = 0.0; Delta_LogRho = 0.0; Energy_Min = 0.0; Delta_Energy = 0.0;
+  LogP_Min = 0.0; Delta_LogP = 0.0; Temp_Min = 0.0; Delta_Temp = 0.0;
+
+}
+
+CLookUpTable::CLookUpTable(CFluidModel *base_model, CConfig *config, su2double P_min, su2double P_max,
+                           su2double T_min, su2double T_max) : CFluidModel() {
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  Base_Model = base_model;
+  Kind_Base_Model = config->GetKind_FluidModel();
+
+  nRho = config->GetLUT_nPoints(); nEnergy = nRho;
+  nPress = nRho; nTemp = nRho;
+
+  LogP_Min = log(P_min); Delta_LogP = (log(P_max) - LogP_Min)/su2double(nPress-1);
+  Temp_Min = T_min;      Delta_Temp = (T_max - T_min)/su2double(nTemp-1);
+
+  Table_rhoe = new su2double[nRho*nEnergy*nVar_rhoe];
+  Table_PT   = new su2double[nPress*nTemp*nVar_PT];
+  Valid_rhoe = new bool[nRho*nEnergy];
+  First_Valid = new unsigned long[nRho];
+
+  /*--- Read the table if a file built with the same model and ranges is
+   available, otherwise generate it from the base model and store it (all
+   the ranks generate the same table, only the master writes it) ---*/
+
+  if (ReadTable(config->GetLUT_FileName())) {
+    if (rank == MASTER_NODE)
+      cout << "Look-up table of the fluid model read from " << config->GetLUT_FileName() << "." << endl;
+  }
+  else {
+    GenerateTable();
+    if (rank == MASTER_NODE) {
+      WriteTable(config->GetLUT_FileName());
+      cout << "Look-up table of the fluid model (" << nRho << "x" << nEnergy << " nodes in (rho, e), ";
+      cout << nPress << "x" << nTemp << " nodes in (P, T)) written to " << config->GetLUT_FileName() << "." << endl;
+    }
+  }
+
+  SetValidity();
+
+}
+
+CLookUpTable::~CLookUpTable(void) {
+
+  if (Base_Model != NULL) delete Base_Model;
+  if (Table_rhoe != NULL) delete [] Table_rhoe;
+  if (Table_PT   != NULL) delete [] Table_PT;
+  if (Valid_rhoe != NULL) delete [] Valid_rhoe;
+  if (First_Valid != NULL) delete [] First_Valid;
+
+}
+
+void CLookUpTable::GenerateTable(void) {
+
+  unsigned long iRho, iEnergy, iPress, iTemp, iRho_m, iRho_p, iSample, nSample = 4*nPress;
+  unsigned short iEdge;
+  su2double P, T, rho, e, Rho_Min, Rho_Max, Energy_Max, Delta_Rho, *Node;
+
+  /*--- Node values of the (P, T) table, row by row in pressure so that the
+   iterative models start from the solution of the previous node ---*/
+
+  for (iPress = 0; iPress < nPress; iPress++) {
+    P = exp(LogP_Min + su2double(iPress)*Delta_LogP);
+    for (iTemp = 0; iTemp < nTemp; iTemp++) {
+      T = Temp_Min + su2double(iTemp)*Delta_Temp;
+      Base_Model->SetTDState_PT(P, T);
+      Node = &Table_PT[(iPress*nTemp+iTemp)*nVar_PT];
+      Node[0] = Base_Model->GetDensity();
+      Node[1] = Base_Model->GetStaticEnergy();
+      Node[2] = Base_Model->GetStaticEnergy() + P/Base_Model->GetDensity();
+      Node[3] = Base_Model->GetEntropy();
+    }
+  }
+
+  /*--- The (rho, e) table covers the image of the (P, T) rectangle, which is
+   bounded by the image of its edges ---*/
+
+  Rho_Min = Table_PT[0]; Rho_Max = Table_PT[0];
+  Energy_Min = Table_PT[1]; Energy_Max = Table_PT[1];
+  for (iSample = 0; iSample <= nSample; iSample++) {
+    for (iEdge = 0; iEdge < 4; iEdge++) {
+      T = Temp_Min + su2double(iSample)/su2double(nSample)*Delta_Temp*su2double(nTemp-1);
+      P = exp(LogP_Min + su2double(iSample)/su2double(nSample)*Delta_LogP*su2double(nPress-1));
+      switch (iEdge) {
+        case 0: P = exp(LogP_Min); break;
+        case 1: P = exp(LogP_Min + Delta_LogP*su2double(nPress-1)); break;
+        case 2: T = Temp_Min; break;
+        case 3: T = Temp_Min + Delta_Temp*su2double(nTemp-1); break;
+      }
+      Base_Model->SetTDState_PT(P, T);
+      Rho_Min = min(Rho_Min, Base_Model->GetDensity());
+      Rho_Max = max(Rho_Max, Base_Model->GetDensity());
+      Energy_Min = min(Energy_Min, Base_Model->GetStaticEnergy());
+      Energy_Max = max(Energy_Max, Base_Model->GetStaticEnergy());
+    }
+  }
+
+  LogRho_Min = log(Rho_Min); Delta_LogRho = (log(Rho_Max) - LogRho_Min)/su2double(nRho-1);
+  Delta_Energy = (Energy_Max - Energy_Min)/su2double(nEnergy-1);
+
+  /*--- Node values of the (rho, e) table ---*/
+
+  for (iRho = 0; iRho < nRho; iRho++) {
+    rho = exp(LogRho_Min + su2double(iRho)*Delta_LogRho);
+    for (iEnergy = 0; iEnergy < nEnergy; iEnergy++) {
+      e = Energy_Min + su2double(iEnergy)*Delta_Energy;
+      Base_Model->SetTDState_rhoe(rho, e);
+      Node = &Table_rhoe[(iRho*nEnergy+iEnergy)*nVar_rhoe];
+      Node[0] = Base_Model->GetPressure();
+      Node[1] = Base_Model->GetTemperature();
+      Node[2] = Base_Model->GetSoundSpeed2();
+      Node[3] = Base_Model->GetEntropy();
+      Node[4] = Base_Model->GetdPdrho_e();
+      Node[5] = Base_Model->GetdPde_rho();
+      Node[6] = Base_Model->GetdTdrho_e();
+      Node[7] = Base_Model->GetdTde_rho();
+      Node[8] = Base_Model->GetCp();
+    }
+  }
+
+  /*--- Not all the models provide dT/drho at constant e, it is computed
+   with differences along the lines of constant energy of the table ---*/
+
+  for (iEnergy = 0; iEnergy < nEnergy; iEnergy++) {
+    for (iRho = 0; iRho < nRho; iRho++) {
+      iRho_m = iRho; iRho_p = iRho;
+      if ((iRho > 0) && (Table_rhoe[((iRho-1)*nEnergy+iEnergy)*nVar_rhoe+1] > 0.0)) iRho_m = iRho-1;
+      if ((iRho < nRho-1) && (Table_rhoe[((iRho+1)*nEnergy+iEnergy)*nVar_rhoe+1] > 0.0)) iRho_p = iRho+1;
+      if (iRho_m == iRho_p) continue;
+      Delta_Rho = exp(LogRho_Min + su2double(iRho_p)*Delta_LogRho) - exp(LogRho_Min + su2double(iRho_m)*Delta_LogRho);
+      Table_rhoe[(iRho*nEnergy+iEnergy)*nVar_rhoe+6] = (Table_rhoe[(iRho_p*nEnergy+iEnergy)*nVar_rhoe+1] -
+                                                        Table_rhoe[(iRho_m*nEnergy+iEnergy)*nVar_rhoe+1])/Delta_Rho;
+    }
+  }
+
+}
+
+void CLookUpTable::SetValidity(void) {
+
+  unsigned long iRho, iEnergy, iVar;
+  su2double *Node;
+  bool Valid;
+
+  /*--- A node is not used when the base model has no physical state there
+   (below the spinodal, negative temperatures in a corner of the table, ...),
+   which only happens at the low energy end of the density lines ---*/
+
+  for (iRho = 0; iRho < nRho; iRho++) {
+    First_Valid[iRho] = 0;
+    for (iEnergy = 0; iEnergy < nEnergy; iEnergy++) {
+      Node = &Table_rhoe[(iRho*nEnergy+iEnergy)*nVar_rhoe];
+      Valid = ((Node[0] > 0.0) && (Node[1] > 0.0) && (Node[2] > 0.0) && (Node[5] > 0.0) && (Node[7] > 0.0));
+      for (iVar = 0; iVar < nVar_rhoe; iVar++)
+        if (Node[iVar] != Node[iVar]) Valid = false;
+      Valid_rhoe[iRho*nEnergy+iEnergy] = Valid;
+      if (!Valid) First_Valid[iRho] = iEnergy+1;
+    }
+  }
+
+}
+
+bool CLookUpTable::ReadTable(string val_filename) {
+
+  ifstream table_file;
+  char Tag[8];
+  unsigned short Kind_Model;
+  unsigned long Size[4], iValue, nValue_rhoe = nRho*nEnergy*nVar_rhoe, nValue_PT = nPress*nTemp*nVar_PT;
+  passivedouble Range[8], Check[nVar_rhoe], *Values;
+  su2double *Node;
+
+  table_file.open(val_filename.c_str(), ios::in | ios::binary);
+  if (table_file.fail()) return false;
+
+  table_file.read(Tag, sizeof(Tag));
+  table_file.read((char *)&Kind_Model, sizeof(unsigned short));
+  table_file.read((char *)Size, 4*sizeof(unsigned long));
+  table_file.read((char *)Range, 8*sizeof(passivedouble));
+  if (table_file.fail() || (memcmp(Tag, LUT_FileTag, sizeof(Tag)) != 0)) return false;
+
+  /*--- The table must have been built with the same model, size and (P, T) range ---*/
+
+  if ((Kind_Model != Kind_Base_Model) || (Size[0] != nRho) || (Size[1] != nEnergy) ||
+      (Size[2] != nPress) || (Size[3] != nTemp)) return false;
+  if ((fabs(Range[4] - SU2_TYPE::GetValue(LogP_Min)) > 1E-12*max(1.0, fabs(Range[4]))) ||
+      (fabs(Range[5] - SU2_TYPE::GetValue(Delta_LogP)) > 1E-12*max(1.0, fabs(Range[5]))) ||
+      (fabs(Range[6] - SU2_TYPE::GetValue(Temp_Min)) > 1E-12*max(1.0, fabs(Range[6]))) ||
+      (fabs(Range[7] - SU2_TYPE::GetValue(Delta_Temp)) > 1E-12*max(1.0, fabs(Range[7])))) return false;
+
+  Values = new passivedouble[max(nValue_rhoe, nValue_PT)];
+
+  table_file.read((char *)Values, nValue_rhoe*sizeof(passivedouble));
+  for (iValue = 0; iValue < nValue_rhoe; iValue++) Table_rhoe[iValue] = Values[iValue];
+  table_file.read((char *)Values, nValue_PT*sizeof(passivedouble));
+  for (iValue = 0; iValue < nValue_PT; iValue++) Table_PT[iValue] = Values[iValue];
+
+  delete [] Values;
+
+  if (table_file.fail()) return false;
+
+  LogRho_Min = Range[0]; Delta_LogRho = Range[1];
+  Energy_Min = Range[2]; Delta_Energy = Range[3];
+
+  /*--- The parameters of the base model (critical point, acentric factor,
+   reference values) are not stored, the model is checked at the central node ---*/
+
+  Base_Model->SetTDState_rhoe(exp(LogRho_Min + su2double(nRho/2)*Delta_LogRho),
+                              Energy_Min + su2double(nEnergy/2)*Delta_Energy);
+  Node = &Table_rhoe[((nRho/2)*nEnergy+nEnergy/2)*nVar_rhoe];
+  Check[0] = SU2_TYPE::GetValue(Base_Model->GetPressure());
+  Check[1] = SU2_TYPE::GetValue(Base_Model->GetTemperature());
+  Check[2] = SU2_TYPE::GetValue(Base_Model->GetSoundSpeed2());
+  for (iValue = 0; iValue < 3; iValue++)
+    if (fabs(Check[iValue] - SU2_TYPE::GetValue(Node[iValue])) > 1E-10*fabs(Check[iValue])) return false;
+
+  return true;
+
+}
+
+void CLookUpTable::WriteTable(string val_filename) {
+
+  ofstream table_file;
+  unsigned short Kind_Model = Kind_Base_Model;
+  unsigned long Size[4] = {nRho, nEnergy, nPress, nTemp}, iValue;
+  unsigned long nValue_rhoe = nRho*nEnergy*nVar_rhoe, nValue_PT = nPress*nTemp*nVar_PT;
+  passivedouble Range[8], *Values;
+
+  Range[0] = SU2_TYPE::GetValue(LogRho_Min); Range[1] = SU2_TYPE::GetValue(Delta_LogRho);
+  Range[2] = SU2_TYPE::GetValue(Energy_Min); Range[3] = SU2_TYPE::GetValue(Delta_Energy);
+  Range[4] = SU2_TYPE::GetValue(LogP_Min);   Range[5] = SU2_TYPE::GetValue(Delta_LogP);
+  Range[6] = SU2_TYPE::GetValue(Temp_Min);   Range[7] = SU2_TYPE::GetValue(Delta_Temp);
+
+  table_file.open(val_filename.c_str(), ios::out | ios::binary | ios::trunc);
+  if (table_file.fail()) {
+    cout << "WARNING: The look-up table could not be written to " << val_filename << "." << endl;
+    return;
+  }
+
+  table_file.write(LUT_FileTag, sizeof(LUT_FileTag));
+  table_file.write((char *)&Kind_Model, sizeof(unsigned short));
+  table_file.write((char *)Size, 4*sizeof(unsigned long));
+  table_file.write((char *)Range, 8*sizeof(passivedouble));
+
+  Values = new passivedouble[max(nValue_rhoe, nValue_PT)];
+  for (iValue = 0; iValue < nValue_rhoe; iValue++) Values[iValue] = SU2_TYPE::GetValue(Table_rhoe[iValue]);
+  table_file.write((char *)Values, nValue_rhoe*sizeof(passivedouble));
+  for (iValue = 0; iValue < nValue_PT; iValue++) Values[iValue] = SU2_TYPE::GetValue(Table_PT[iValue]);
+  table_file.write((char *)Values, nValue_PT*sizeof(passivedouble));
+  delete [] Values;
+
+  table_file.close();
+
+}
+
+bool CLookUpTable::Interpolate_rhoe(su2double rho, su2double e, su2double *val, su2double *val_drho, su2double *val_de) {
+
+  su2double x, y, w00, w01, w10, w11;
+  su2double *Node00, *Node01, *Node10, *Node11;
+  unsigned long iRho, iEnergy, iNode;
+  unsigned short iVar;
+
+  /*--- Cell of the structured grid (uniform in log(rho) and e) ---*/
+
+  if (rho <= 0.0) return false;
+  x = (log(rho) - LogRho_Min)/Delta_LogRho;
+  y = (e - Energy_Min)/Delta_Energy;
+  if ((x < 0.0) || (x > su2double(nRho-1)) || (y < 0.0) || (y > su2double(nEnergy-1))) return false;
+
+  iRho    = min((unsigned long)SU2_TYPE::Int(x), nRho-2);
+  iEnergy = min((unsigned long)SU2_TYPE::Int(y), nEnergy-2);
+  iNode   = iRho*nEnergy+iEnergy;
+  if (!(Valid_rhoe[iNode] && Valid_rhoe[iNode+1] && Valid_rhoe[iNode+nEnergy] && Valid_rhoe[iNode+nEnergy+1]))
+    return false;
+
+  /*--- Bilinear interpolation ---*/
+
+  x -= su2double(iRho); y -= su2double(iEnergy);
+  w00 = (1.0-x)*(1.0-y); w01 = (1.0-x)*y; w10 = x*(1.0-y); w11 = x*y;
+  Node00 = &Table_rhoe[iNode*nVar_rhoe];           Node01 = &Table_rhoe[(iNode+1)*nVar_rhoe];
+  Node10 = &Table_rhoe[(iNode+nEnergy)*nVar_rhoe]; Node11 = &Table_rhoe[(iNode+nEnergy+1)*nVar_rhoe];
+
+  for (iVar = 0; iVar < nVar_rhoe; iVar++)
+    val[iVar] = w00*Node00[iVar] + w01*Node01[iVar] + w10*Node10[iVar] + w11*Node11[iVar];
+
+  /*--- Derivatives of the interpolant (d/drho = d/dlog(rho) / rho) of the
+   pressure, temperature, speed of sound and entropy ---*/
+
+  if (val_drho != NULL) {
+    for (iVar = 0; iVar < 4; iVar++) {
+      val_drho[iVar] = ((1.0-y)*(Node10[iVar]-Node00[iVar]) + y*(Node11[iVar]-Node01[iVar]))/(Delta_LogRho*rho);
+      val_de[iVar]   = ((1.0-x)*(Node01[iVar]-Node00[iVar]) + x*(Node11[iVar]-Node10[iVar]))/Delta_Energy;
+    }
+  }
+
+  return true;
+
+}
+
+bool CLookUpTable::Interpolate_PT(su2double P, su2double T, su2double *val) {
+
+  su2double x, y, w00, w01, w10, w11;
+  su2double *Node00, *Node01, *Node10, *Node11;
+  unsigned long iPress, iTemp, iNode;
+  unsigned short iVar;
+
+  if (P <= 0.0) return false;
+  x = (log(P) - LogP_Min)/Delta_LogP;
+  y = (T - Temp_Min)/Delta_Temp;
+  if ((x < 0.0) || (x > su2double(nPress-1)) || (y < 0.0) || (y > su2double(nTemp-1))) return false;
+
+  iPress = min((unsigned long)SU2_TYPE::Int(x), nPress-2);
+  iTemp  = min((unsigned long)SU2_TYPE::Int(y), nTemp-2);
+  iNode  = iPress*nTemp+iTemp;
+
+  x -= su2double(iPress); y -= su2double(iTemp);
+  w00 = (1.0-x)*(1.0-y); w01 = (1.0-x)*y; w10 = x*(1.0-y); w11 = x*y;
+  Node00 = &Table_PT[iNode*nVar_PT];         Node01 = &Table_PT[(iNode+1)*nVar_PT];
+  Node10 = &Table_PT[(iNode+nTemp)*nVar_PT]; Node11 = &Table_PT[(iNode+nTemp+1)*nVar_PT];
+
+  for (iVar = 0; iVar < nVar_PT; iVar++)
+    val[iVar] = w00*Node00[iVar] + w01*Node01[iVar] + w10*Node10[iVar] + w11*Node11[iVar];
+
+  return true;
+
+}
+
+bool CLookUpTable::Search_Energy(su2double rho, su2double val, unsigned short iVar, su2double &e) {
+
+  su2double x, F_lo, F_hi, F_mid;
+  unsigned long iRho, jLow, jHigh, jMid;
+
+  /*--- Along a density line of the table P and T grow with e, the cell is
+   found by bisection and the (linear in e) interpolant inverted in it ---*/
+
+  if (rho <= 0.0) return false;
+  x = (log(rho) - LogRho_Min)/Delta_LogRho;
+  if ((x < 0.0) || (x > su2double(nRho-1))) return false;
+  iRho = min((unsigned long)SU2_TYPE::Int(x), nRho-2);
+  x -= su2double(iRho);
+
+  jLow = max(First_Valid[iRho], First_Valid[iRho+1]); jHigh = nEnergy-1;
+  if (jLow >= jHigh) return false;
+
+  F_lo = (1.0-x)*Table_rhoe[(iRho*nEnergy+jLow)*nVar_rhoe+iVar] + x*Table_rhoe[((iRho+1)*nEnergy+jLow)*nVar_rhoe+iVar];
+  F_hi = (1.0-x)*Table_rhoe[(iRho*nEnergy+jHigh)*nVar_rhoe+iVar] + x*Table_rhoe[((iRho+1)*nEnergy+jHigh)*nVar_rhoe+iVar];
+  if ((val < F_lo) || (val > F_hi)) return false;
+
+  while (jHigh - jLow > 1) {
+    jMid = (jLow + jHigh)/2;
+    F_mid = (1.0-x)*Table_rhoe[(iRho*nEnergy+jMid)*nVar_rhoe+iVar] + x*Table_rhoe[((iRho+1)*nEnergy+jMid)*nVar_rhoe+iVar];
+    if (val < F_mid) { jHigh = jMid; F_hi = F_mid; }
+    else { jLow = jMid; F_lo = F_mid; }
+  }
+
+  e = Energy_Min + Delta_Energy*(su2double(jLow) + (val - F_lo)/(F_hi - F_lo));
+
+  return true;
+
+}
+
+short CLookUpTable::Search_Temperature(su2double P, su2double s, su2double &T) {
+
+  su2double x, s_lo, s_hi, s_mid;
+  unsigned long iPress, kLow = 0, kHigh = nTemp-1, kMid;
+
+  /*--- Along an isobar the entropy grows with the temperature ---*/
+
+  if (P <= 0.0) return -2;
+  x = (log(P) - LogP_Min)/Delta_LogP;
+  if ((x < 0.0) || (x > su2double(nPress-1))) return -2;
+  iPress = min((unsigned long)SU2_TYPE::Int(x), nPress-2);
+  x -= su2double(iPress);
+
+  s_lo = (1.0-x)*Table_PT[(iPress*nTemp+kLow)*nVar_PT+3] + x*Table_PT[((iPress+1)*nTemp+kLow)*nVar_PT+3];
+  s_hi = (1.0-x)*Table_PT[(iPress*nTemp+kHigh)*nVar_PT+3] + x*Table_PT[((iPress+1)*nTemp+kHigh)*nVar_PT+3];
+  if (s < s_lo) return -1;
+  if (s > s_hi) return 1;
+
+  while (kHigh - kLow > 1) {
+    kMid = (kLow + kHigh)/2;
+    s_mid = (1.0-x)*Table_PT[(iPress*nTemp+kMid)*nVar_PT+3] + x*Table_PT[((iPress+1)*nTemp+kMid)*nVar_PT+3];
+    if (s < s_mid) { kHigh = kMid; s_hi = s_mid; }
+    else { kLow = kMid; s_lo = s_mid; }
+  }
+
+  T = Temp_Min + Delta_Temp*(su2double(kLow) + (s - s_lo)/(s_hi - s_lo));
+
+  return 0;
+
+}
+
+bool CLookUpTable::Newton_rhoe(su2double X, su2double Y, unsigned short val_pair, su2double &rho, su2double &e, su2double *val) {
+
+  su2double val_drho[4], val_de[4], F[2], J[2][2], det, d_rho, d_e;
+  su2double toll = 1E-10;
+  unsigned short iIter, nIter = 10;
+
+  /*--- Newton iterations with the exact derivatives of the bilinear
+   interpolant, which converge quadratically to the state of the table ---*/
+
+  for (iIter = 0; iIter < nIter; iIter++) {
+
+    if (!Interpolate_rhoe(rho, e, val, val_drho, val_de)) return false;
+
+    switch (val_pair) {
+      case PT_PAIR:
+        F[0] = val[0] - X; J[0][0] = val_drho[0]; J[0][1] = val_de[0];
+        F[1] = val[1] - Y; J[1][0] = val_drho[1]; J[1][1] = val_de[1];
+        break;
+      case PS_PAIR:
+        F[0] = val[0] - X; J[0][0] = val_drho[0]; J[0][1] = val_de[0];
+        F[1] = val[3] - Y; J[1][0] = val_drho[3]; J[1][1] = val_de[3];
+        break;
+      case HS_PAIR:
+        F[0] = e + val[0]/rho - X; J[0][0] = val_drho[0]/rho - val[0]/(rho*rho); J[0][1] = 1.0 + val_de[0]/rho;
+        F[1] = val[3] - Y;         J[1][0] = val_drho[3];                       J[1][1] = val_de[3];
+        break;
+    }
+
+    det = J[0][0]*J[1][1] - J[0][1]*J[1][0];
+    if (det == 0.0) return false;
+    d_rho = -( J[1][1]*F[0] - J[0][1]*F[1])/det;
+    d_e   = -(-J[1][0]*F[0] + J[0][0]*F[1])/det;
+
+    /*--- Keep the density positive ---*/
+
+    if (rho + d_rho < 0.5*rho) { d_e *= 0.5*rho/fabs(d_rho); d_rho = -0.5*rho; }
+    rho += d_rho; e += d_e;
+
+    if ((fabs(d_rho) <= toll*rho) && (fabs(d_e) <= toll*Delta_Energy*su2double(nEnergy-1)))
+      return Interpolate_rhoe(rho, e, val);
+
+  }
+
+  return false;
+
+}
+
+void CLookUpTable::SetState_Table(su2double rho, su2double e, su2double *val) {
+
+  Density      = rho;
+  StaticEnergy = e;
+  Pressure     = val[0];
+  Temperature  = val[1];
+  SoundSpeed2  = val[2];
+  Entropy      = val[3];
+  dPdrho_e     = val[4];
+  dPde_rho     = val[5];
+  dTdrho_e     = val[6];
+  dTde_rho     = val[7];
+  Cp           = val[8];
+
+}
+
+void CLookUpTable::SetState_BaseModel(void) {
+
+  Density      = Base_Model->GetDensity();
+  StaticEnergy = Base_Model->GetStaticEnergy();
+  Pressure     = Base_Model->GetPressure();
+  Temperature  = Base_Model->GetTemperature();
+  SoundSpeed2  = Base_Model->GetSoundSpeed2();
+  Entropy      = Base_Model->GetEntropy();
+  dPdrho_e     = Base_Model->GetdPdrho_e();
+  dPde_rho     = Base_Model->GetdPde_rho();
+  dTdrho_e     = Base_Model->GetdTdrho_e();
+  dTde_rho     = Base_Model->GetdTde_rho();
+  Cp           = Base_Model->GetCp();
+
+}
+
+void CLookUpTable::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  su2double val[nVar_rhoe];
+
+  if (Interpolate_rhoe(rho, e, val)) SetState_Table(rho, e, val);
+  else { Base_Model->SetTDState_rhoe(rho, e); SetState_BaseModel(); }
+
+}
+
+void CLookUpTable::SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState) {
+
+  unsigned long iState;
+
+  for (iState = 0; iState < nState; iState++) {
+    CLookUpTable::SetTDState_rhoe(rho[iState], e[iState]);
+    GetTDState(&TDState[iState*N_TDSTATE]);
+  }
+
+}
+
+void CLookUpTable::SetTDState_PT (su2double P, su2double T ) {
+
+  su2double val[nVar_rhoe], rho, e;
+
+  /*--- The (P, T) table gives the starting point of the Newton iterations,
+   which make the state consistent with the (rho, e) table ---*/
+
+  if (Interpolate_PT(P, T, val)) {
+    rho = val[0]; e = val[1];
+    if (Newton_rhoe(P, T, PT_PAIR, rho, e, val)) {
+      SetState_Table(rho, e, val);
+      return;
+    }
+  }
+
+  Base_Model->SetTDState_PT(P, T); SetState_BaseModel();
+
+}
+
+void CLookUpTable::SetTDState_Prho (su2double P, su2double rho ) {
+
+  su2double val[nVar_rhoe], e;
+
+  if (Search_Energy(rho, P, 0, e) && Interpolate_rhoe(rho, e, val)) SetState_Table(rho, e, val);
+  else { Base_Model->SetTDState_Prho(P, rho); SetState_BaseModel(); }
+
+}
+
+void CLookUpTable::SetEnergy_Prho (su2double P, su2double rho ) {
+
+  su2double e;
+
+  if (Search_Energy(rho, P, 0, e)) StaticEnergy = e;
+  else { Base_Model->SetEnergy_Prho(P, rho); StaticEnergy = Base_Model->GetStaticEnergy(); }
+
+}
+
+void CLookUpTable::SetTDState_rhoT (su2double rho, su2double T ) {
+
+  su2double val[nVar_rhoe], e;
+
+  if (Search_Energy(rho, T, 1, e) && Interpolate_rhoe(rho, e, val)) SetState_Table(rho, e, val);
+  else { Base_Model->SetTDState_rhoT(rho, T); SetState_BaseModel(); }
+
+}
+
+void CLookUpTable::SetTDState_Ps (su2double P, su2double s ) {
+
+  su2double val[nVar_rhoe], T, rho, e;
+
+  if ((Search_Temperature(P, s, T) == 0) && Interpolate_PT(P, T, val)) {
+    rho = val[0]; e = val[1];
+    if (Newton_rhoe(P, s, PS_PAIR, rho, e, val)) {
+      SetState_Table(rho, e, val);
+      return;
+    }
+  }
+
+  Base_Model->SetTDState_Ps(P, s); SetState_BaseModel();
+
+}
+
+void CLookUpTable::SetTDState_hs (su2double h, su2double s ) {
+
+  su2double val[nVar_rhoe], P, T, rho, e, h_lo = 0.0, h_hi = 0.0, h_mid = 0.0;
+  unsigned long iLow = 0, iHigh = nPress-1, iMid;
+  short Side_Low, Side_High, Side_Mid;
+
+  /*--- Along an isentrope the temperature and the enthalpy grow with the
+   pressure (dh = v dP). The isobars of the (P, T) table are bisected for h,
+   where an isobar crossed by the isentrope below (above) the temperature
+   range of the table counts as an enthalpy lower (higher) than h ---*/
+
+  Side_Low = Search_Temperature(exp(LogP_Min), s, T);
+  if ((Side_Low == 0) && Interpolate_PT(exp(LogP_Min), T, val)) h_lo = val[2];
+  Side_High = Search_Temperature(exp(LogP_Min + su2double(iHigh)*Delta_LogP), s, T);
+  if ((Side_High == 0) && Interpolate_PT(exp(LogP_Min + su2double(iHigh)*Delta_LogP), T, val)) h_hi = val[2];
+
+  if (((Side_Low == -1) || ((Side_Low == 0) && (h >= h_lo))) &&
+      ((Side_High == 1) || ((Side_High == 0) && (h <= h_hi)))) {
+
+    while (iHigh - iLow > 1) {
+      iMid = (iLow + iHigh)/2;
+      P = exp(LogP_Min + su2double(iMid)*Delta_LogP);
+      Side_Mid = Search_Temperature(P, s, T);
+      if ((Side_Mid == 0) && Interpolate_PT(P, T, val)) h_mid = val[2];
+      if ((Side_Mid == 1) || ((Side_Mid == 0) && (h < h_mid))) { iHigh = iMid; h_hi = h_mid; Side_High = Side_Mid; }
+      else { iLow = iMid; h_lo = h_mid; Side_Low = Side_Mid; }
+    }
+
+    if ((Side_Low == 0) && (Side_High == 0)) {
+      P = exp(LogP_Min + Delta_LogP*(su2double(iLow) + (h - h_lo)/(h_hi - h_lo)));
+      if ((Search_Temperature(P, s, T) == 0) && Interpolate_PT(P, T, val)) {
+        rho = val[0]; e = val[1];
+        if (Newton_rhoe(h, s, HS_PAIR, rho, e, val)) {
+          SetState_Table(rho, e, val);
+          return;
+        }
+      }
+    }
+  }
+
+  Base_Model->SetTDState_hs(h, s); SetState_BaseModel();
+
+}
@@ -67,6 +67,32 @@ void CIdealGas::SetTDState_rhoe (su2double rho, su2double e ) {
 
 }
 
+void CIdealGas::SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState) {
+
+  unsigned long iState;
+  su2double P, *State;
+
+  /*--- Same equations as SetTDState_rhoe, without the entropy (not needed by the solver) ---*/
+
+  for (iState = 0; iState < nState; iState++) {
+    State = &TDState[iState*N_TDSTATE];
+    P = Gamma_Minus_One*rho[iState]*e[iState];
+    State[TD_PRESSURE]    = P;
+    State[TD_TEMPERATURE] = Gamma_Minus_One*e[iState]/Gas_Constant;
+    State[TD_SOUNDSPEED2] = Gamma*P/rho[iState];
+    State[TD_CP]          = Cp;
+    State[TD_DPDRHO_E]    = Gamma_Minus_One*e[iState];
+    State[TD_DPDE_RHO]    = Gamma_Minus_One*rho[iState];
+    State[TD_DTDRHO_E]    = 0.0;
+    State[TD_DTDE_RHO]    = Gamma_Minus_One/Gas_Constant;
+  }
+
+  /*--- Leave the model in the state of the last point ---*/
+
+  if (nState > 0) CIdealGas::SetTDState_rhoe(rho[nState-1], e[nState-1]);
+
+}
+
 void CIdealGas::SetTDState_PT (su2double P, su2double T ) {
 	su2double e = T*Gas_Constant/Gamma_Minus_One;
 	su2double rho = P/(T*Gas_Constant);
@@ -148,6 +148,58 @@ void CPengRobinson::SetTDState_rhoe (su2double rho, su2double e ) {
 
 }
 
+void CPengRobinson::SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState) {
+
+  unsigned long iState;
+  su2double DpDd_T, DpDT_d, DeDd_T, Cv, dPde, dPdrho;
+  su2double A, B, C, fv, a2T, d, d2, T, P, *State;
+  su2double sqrt2 = sqrt(2.0), A_Cv = Gas_Constant / Gamma_Minus_One;
+
+  /*--- Same equations as SetTDState_rhoe, without the entropy (not needed by the solver) ---*/
+
+  for (iState = 0; iState < nState; iState++) {
+    State = &TDState[iState*N_TDSTATE];
+    d = rho[iState];
+    d2 = d*d;
+
+    fv = (log(1.0+( d * b * sqrt2/(1 + d*b))) - log(1.0-( d * b * sqrt2/(1 + d*b))))/2.0;
+
+    B = a*k*(k+1)*fv/(b*sqrt2*sqrt(TstarCrit));
+    C = a*(k+1)*(k+1)*fv/(b*sqrt2) + e[iState];
+
+    T = ( -B + sqrt(B*B + 4*A_Cv*C) ) / (2*A_Cv);
+    T *= T;
+
+    a2T = alpha2(T);
+
+    A = (1/d2 + 2*b/d - b*b);
+    B = 1/d-b;
+
+    P = T*Gas_Constant / B - a*a2T / A;
+
+    DpDd_T =  ( T*Gas_Constant /(B*B    ) - 2*a*a2T*(1/d + b) /( A*A ) ) /(d2);
+    DpDT_d = Gas_Constant /B + a*k / A * sqrt( a2T/(T*TstarCrit) );
+    Cv = Gas_Constant/Gamma_Minus_One + ( a*k*(k+1)*fv ) / ( 2*b*sqrt(2*T*TstarCrit) );
+    dPde = DpDT_d/Cv;
+    DeDd_T = - a*(1+k) * sqrt( a2T ) / A / (d2);
+    dPdrho = DpDd_T - dPde*DeDd_T;
+
+    State[TD_PRESSURE]    = P;
+    State[TD_TEMPERATURE] = T;
+    State[TD_SOUNDSPEED2] = dPdrho + P/(d2)*dPde;
+    State[TD_CP]          = Cp;
+    State[TD_DPDRHO_E]    = dPdrho;
+    State[TD_DPDE_RHO]    = dPde;
+    State[TD_DTDRHO_E]    = dTdrho_e;
+    State[TD_DTDE_RHO]    = 1/Cv;
+  }
+
+  /*--- Leave the model in the state of the last point (also sets the compressibility factor) ---*/
+
+  if (nState > 0) CPengRobinson::SetTDState_rhoe(rho[nState-1], e[nState-1]);
+
+}
+
 void CPengRobinson::SetTDState_PT (su2double P, su2double T ) {
 	su2double toll= 1e-6;
 	su2double A, B, Z, DZ=1.0, F, F1, atanh;
@@ -166,6 +218,7 @@ void CPengRobinson::SetTDState_PT (su2double P, su2double T ) {
 		F1 = 3*Z*Z + 2*Z*(B - 1.0) + (A - 2*B - 3*B*B);
 		DZ = F/F1;
 		Z-= DZ;
+		count++;
 	} while(abs(DZ)>toll && count < nmax);
 
 	if (count == nmax) {
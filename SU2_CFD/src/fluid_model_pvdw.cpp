@@ -69,6 +69,35 @@ void CVanDerWaalsGas::SetTDState_rhoe (su2double rho, su2double e ) {
     Zed = Pressure/(Gas_Constant*Temperature*Density);
 }
 
+void CVanDerWaalsGas::SetTDState_rhoe_Batch (unsigned long nState, su2double *rho, su2double *e, su2double *TDState) {
+
+  unsigned long iState;
+  su2double d, P, dPde, dPdrho, *State;
+
+  /*--- Same equations as SetTDState_rhoe, without the entropy (not needed by the solver) ---*/
+
+  for (iState = 0; iState < nState; iState++) {
+    State = &TDState[iState*N_TDSTATE];
+    d = rho[iState];
+    P = Gamma_Minus_One*d/(1.0-d*b)*(e[iState] + d*a) - a*d*d;
+    dPde = d*Gamma_Minus_One/(1.0 - d*b);
+    dPdrho = Gamma_Minus_One/(1.0 - d*b)*((e[iState] + 2*d*a) + d*b*(e[iState] + d*a)/(1.0 - d*b)) - 2*d*a;
+    State[TD_PRESSURE]    = P;
+    State[TD_TEMPERATURE] = (P+d*d*a)*((1-d*b)/(d*Gas_Constant));
+    State[TD_SOUNDSPEED2] = dPdrho + P/(d*d)*dPde;
+    State[TD_CP]          = Cp;
+    State[TD_DPDRHO_E]    = dPdrho;
+    State[TD_DPDE_RHO]    = dPde;
+    State[TD_DTDRHO_E]    = Gamma_Minus_One/Gas_Constant*a;
+    State[TD_DTDE_RHO]    = Gamma_Minus_One/Gas_Constant;
+  }
+
+  /*--- Leave the model in the state of the last point (also sets the compressibility factor) ---*/
+
+  if (nState > 0) CVanDerWaalsGas::SetTDState_rhoe(rho[nState-1], e[nState-1]);
+
+}
+
 
 void CVanDerWaalsGas::SetTDState_PT (su2double P, su2double T ) {
 	su2double toll= 1e-5;
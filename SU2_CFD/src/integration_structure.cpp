@@ -952,6 +952,9 @@ void CIntegration::Convergence_Monitoring_FSI(CGeometry *fea_geometry, CConfig *
     else if (RelaxMethod_FSI == AITKEN_DYNAMIC){
       WAitken = fea_solver->GetWAitken_Dyn();
     }
+    else if (RelaxMethod_FSI == IQN_ILS){
+      WAitken = fea_solver->GetWAitken_Dyn();
+    }
     else {
       WAitken = 1.0;
       cout << "No relaxation parameter used. " << endl;
@@ -31,6 +31,108 @@
 
 #include "../include/output_structure.hpp"
 
+#ifdef HAVE_ZLIB
+  #include "zlib.h"
+#endif
+
+/*--- Size (in bytes) of the blocks in which the zlib compressed
+ data arrays of the XML files are split. ---*/
+
+static const uint64_t VTK_ZLIB_BLOCK_SIZE = 1048576;
+
+/*!
+ * \brief Check the byte order of the machine.
+ * \return <code>TRUE</code> if the machine is big endian.
+ */
+static bool IsBigEndian(void) {
+  unsigned short one = 1;
+  return (*((unsigned char *)&one) == 0);
+}
+
+/*!
+ * \brief Write a block of values to a legacy VTK binary file in one call.
+ *        Legacy VTK files are always big endian, so the values are swapped
+ *        in place on little endian machines before being written.
+ */
+static void WriteLegacy_Block(ofstream &file, void *buffer, size_t size, size_t count) {
+
+  if (count == 0) return;
+
+  char *bytes = (char *)buffer;
+  if (!IsBigEndian() && size > 1) {
+    for (size_t iCount = 0; iCount < count; iCount++) {
+      char *value = &bytes[iCount*size];
+      for (size_t iByte = 0; iByte < size/2; iByte++) {
+        char tmp = value[iByte];
+        value[iByte] = value[size-1-iByte];
+        value[size-1-iByte] = tmp;
+      }
+    }
+  }
+  file.write(bytes, size*count);
+  file << "\n";
+
+}
+
+/*!
+ * \brief Encode a data array as a block of the appended section of an XML
+ *        VTK file (UInt64 header), optionally compressed with zlib.
+ */
+static void EncodeAppended_Block(const void *buffer, uint64_t nBytes, bool compress, vector<char> &block) {
+
+  const char *bytes = (const char *)buffer;
+  block.clear();
+
+  if (!compress) {
+    block.resize(sizeof(uint64_t) + nBytes);
+    memcpy(&block[0], &nBytes, sizeof(uint64_t));
+    if (nBytes > 0) memcpy(&block[sizeof(uint64_t)], bytes, nBytes);
+    return;
+  }
+
+#ifdef HAVE_ZLIB
+
+  /*--- Compressed arrays start with [nBlocks, BlockSize, LastBlockSize,
+   CompressedSize_0, ..., CompressedSize_nBlocks-1], followed by the
+   compressed blocks themselves. ---*/
+
+  uint64_t iBlock, nBlocks = (nBytes + VTK_ZLIB_BLOCK_SIZE - 1)/VTK_ZLIB_BLOCK_SIZE;
+  uint64_t LastBlockSize = nBytes - (nBlocks > 0 ? (nBlocks-1)*VTK_ZLIB_BLOCK_SIZE : 0);
+  vector<uint64_t> Header(3+nBlocks);
+  vector<char> Compressed(compressBound(VTK_ZLIB_BLOCK_SIZE));
+  vector<char> Blocks;
+
+  Header[0] = nBlocks; Header[1] = VTK_ZLIB_BLOCK_SIZE; Header[2] = LastBlockSize;
+
+  for (iBlock = 0; iBlock < nBlocks; iBlock++) {
+    uLong SourceSize = (iBlock == nBlocks-1) ? LastBlockSize : VTK_ZLIB_BLOCK_SIZE;
+    uLongf DestSize = Compressed.size();
+    compress2((Bytef *)&Compressed[0], &DestSize, (const Bytef *)&bytes[iBlock*VTK_ZLIB_BLOCK_SIZE], SourceSize, Z_DEFAULT_COMPRESSION);
+    Header[3+iBlock] = DestSize;
+    Blocks.insert(Blocks.end(), Compressed.begin(), Compressed.begin()+DestSize);
+  }
+
+  block.resize(Header.size()*sizeof(uint64_t) + Blocks.size());
+  memcpy(&block[0], &Header[0], Header.size()*sizeof(uint64_t));
+  if (!Blocks.empty()) memcpy(&block[Header.size()*sizeof(uint64_t)], &Blocks[0], Blocks.size());
+
+#endif
+
+}
+
+/*!
+ * \brief Make a variable name valid for both the legacy and the XML VTK formats.
+ */
+static string SanitizeVTK_Name(string name) {
+  string valid;
+  for (size_t iChar = 0; iChar < name.size(); iChar++) {
+    char c = name[iChar];
+    if ((c == ' ') || (c == '\t')) valid += '_';
+    else if ((c != '<') && (c != '>') && (c != '&') && (c != '"')) valid += c;
+  }
+  return valid;
+}
+
 void COutput::SetParaview_ASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
     
 	unsigned short iDim, iVar, nDim = geometry->GetnDim();
@@ -1766,3 +1868,375 @@ void COutput::SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsign
   if (SurfacePoint != NULL) delete [] SurfacePoint;
   
 }
+
+void COutput::SetParaview_Binary(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+  
+  string extension = (config->GetOutput_FileFormat() == PARAVIEW_XML) ? ".vtu" : ".vtk";
+  string filename = GetParaview_FileName(config, val_iZone, val_nZone, surf_sol, false, false, extension);
+  
+  WriteParaview_Binary(config, geometry, filename, surf_sol, true);
+  
+}
+
+void COutput::SetParaview_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file) {
+  
+  string extension = (config->GetOutput_FileFormat() == PARAVIEW_XML) ? ".vtu" : ".vtk";
+  string filename = GetParaview_FileName(config, val_iZone, val_nZone, surf_sol, true, new_file, extension);
+  
+  /*--- SU2_DEF only writes the (deformed) grid, there is no solution. ---*/
+  
+  WriteParaview_Binary(config, geometry, filename, surf_sol, (config->GetKind_SU2() != SU2_DEF));
+  
+}
+
+string COutput::GetParaview_FileName(CConfig *config, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool mesh_file, bool new_file, string extension) {
+  
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  unsigned long iExtIter = config->GetExtIter();
+  bool adjoint = config->GetContinuous_Adjoint();
+  bool disc_adj = config->GetDiscrete_Adjoint() && !mesh_file;
+  char buffer[50];
+  string filename;
+  
+  /*--- Base name of the file ---*/
+  
+  if (surf_sol) {
+    if (adjoint || disc_adj) filename = config->GetSurfAdjCoeff_FileName();
+    else filename = config->GetSurfFlowCoeff_FileName();
+  }
+  else {
+    if (adjoint || disc_adj) filename = config->GetAdj_FileName();
+    else filename = config->GetFlow_FileName();
+  }
+  
+  if (mesh_file && (config->GetKind_SU2() == SU2_DEF)) {
+    if (new_file) filename = surf_sol ? "surface_grid" : "volumetric_grid";
+    else filename = surf_sol ? "surface_deformed_grid" : "volumetric_deformed_grid";
+  }
+  
+  if (Kind_Solver == FEM_ELASTICITY) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName();
+    else filename = config->GetStructure_FileName();
+  }
+  
+  if (Kind_Solver == WAVE_EQUATION) filename = config->GetWave_FileName();
+  if (Kind_Solver == POISSON_EQUATION) filename = config->GetStructure_FileName();
+  if (Kind_Solver == HEAT_EQUATION) filename = config->GetHeat_FileName();
+  
+  if (!mesh_file && (config->GetKind_SU2() == SU2_DOT)) {
+    if (surf_sol) filename = config->GetSurfSens_FileName();
+    else filename = config->GetVolSens_FileName();
+  }
+  
+  /*--- Special cases where a number needs to be appended to the file name. ---*/
+  
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS || Kind_Solver == FEM_ELASTICITY ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS) &&
+      (val_nZone > 1) && (config->GetUnsteady_Simulation() != TIME_SPECTRAL)) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    filename.append(buffer);
+  }
+  
+  if (config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
+    SPRINTF (buffer, "_%05d", SU2_TYPE::Int(val_iZone));
+    filename.append(buffer);
+  } else if ((config->GetUnsteady_Simulation() && config->GetWrt_Unsteady()) ||
+             (config->GetDynamic_Analysis() && config->GetWrt_Dynamic())) {
+    SPRINTF (buffer, "_%05d", SU2_TYPE::Int(iExtIter));
+    filename.append(buffer);
+  }
+  
+  return filename + extension;
+  
+}
+
+void COutput::SetParaview_FieldNames(CConfig *config, CGeometry *geometry, vector<string> & FieldNames, vector<unsigned short> & FieldIndex) {
+  
+  unsigned short iVar, iDim, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  unsigned short VarCounter = 0;
+  bool grid_movement = config->GetGrid_Movement();
+  bool fem = (Kind_Solver == FEM_ELASTICITY);
+  string fieldname;
+  stringstream name;
+  vector<string> Names;
+  
+  FieldNames.clear(); FieldIndex.clear();
+  
+  if ((config->GetKind_SU2() == SU2_SOL) || (config->GetKind_SU2() == SU2_DOT)) {
+    
+    /*--- If SU2_SOL or SU2_DOT called this routine, the output variables
+     (including the coordinates, which are skipped) are stored in the config. ---*/
+    
+    for (unsigned short iField = 1; iField < config->fields.size(); iField++) {
+      fieldname = config->fields[iField];
+      if ((fieldname.find("\"x\"") == string::npos) &&
+          (fieldname.find("\"y\"") == string::npos) &&
+          (fieldname.find("\"z\"") == string::npos)) {
+        fieldname.erase(remove(fieldname.begin(), fieldname.end(), '"'), fieldname.end());
+        FieldNames.push_back(SanitizeVTK_Name(fieldname));
+        FieldIndex.push_back(iField-1);
+      }
+    }
+    return;
+    
+  }
+  
+  /*--- Same ordering as the merged Data array (see SetParaview_ASCII). ---*/
+  
+  for (iVar = 0; iVar < nVar_Consv; iVar++) {
+    name.str(string()); name << (fem ? "Displacement_" : "Conservative_") << iVar+1; Names.push_back(name.str());
+  }
+  if (config->GetWrt_Limiters()) {
+    for (iVar = 0; iVar < nVar_Consv; iVar++) {
+      name.str(string()); name << "Limiter_" << iVar+1; Names.push_back(name.str());
+    }
+  }
+  if (config->GetWrt_Residuals()) {
+    for (iVar = 0; iVar < nVar_Consv; iVar++) {
+      name.str(string()); name << "Residual_" << iVar+1; Names.push_back(name.str());
+    }
+  }
+  if (grid_movement && !fem) {
+    Names.push_back("Grid_Velx"); Names.push_back("Grid_Vely");
+    if (nDim == 3) Names.push_back("Grid_Velz");
+  }
+  if (config->GetKind_Regime() == FREESURFACE) {
+    Names.push_back("Density");
+  }
+  if ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+    Names.push_back("Pressure"); Names.push_back("Temperature");
+    Names.push_back("Pressure_Coefficient"); Names.push_back("Mach");
+  }
+  if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+    Names.push_back("Laminar_Viscosity");
+    Names.push_back("Skin_Friction_Coefficient_X"); Names.push_back("Skin_Friction_Coefficient_Y");
+    if (nDim == 3) Names.push_back("Skin_Friction_Coefficient_Z");
+    Names.push_back("Heat_Flux"); Names.push_back("Y_Plus");
+  }
+  if (Kind_Solver == RANS) {
+    Names.push_back("Eddy_Viscosity");
+  }
+  if ((Kind_Solver == ADJ_EULER) || (Kind_Solver == ADJ_NAVIER_STOKES) || (Kind_Solver == ADJ_RANS) ||
+      (Kind_Solver == DISC_ADJ_EULER) || (Kind_Solver == DISC_ADJ_NAVIER_STOKES) || (Kind_Solver == DISC_ADJ_RANS)) {
+    Names.push_back("Surface_Sensitivity");
+  }
+  if ((Kind_Solver == DISC_ADJ_EULER) || (Kind_Solver == DISC_ADJ_NAVIER_STOKES) || (Kind_Solver == DISC_ADJ_RANS)) {
+    Names.push_back("Sensitivity_x"); Names.push_back("Sensitivity_y");
+    if (nDim == 3) Names.push_back("Sensitivity_z");
+  }
+  if (fem) {
+    if (config->GetDynamic_Analysis() == DYNAMIC) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        name.str(string()); name << "Velocity_" << iDim+1; Names.push_back(name.str());
+      }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        name.str(string()); name << "Acceleration_" << iDim+1; Names.push_back(name.str());
+      }
+    }
+    Names.push_back("Sxx"); Names.push_back("Syy"); Names.push_back("Sxy");
+    if (nDim == 3) { Names.push_back("Szz"); Names.push_back("Sxz"); Names.push_back("Syz"); }
+    Names.push_back("Von_Mises_Stress");
+  }
+  
+  for (VarCounter = 0; VarCounter < Names.size(); VarCounter++) {
+    FieldNames.push_back(Names[VarCounter]);
+    FieldIndex.push_back(VarCounter);
+  }
+  
+}
+
+void COutput::WriteParaview_Binary(CConfig *config, CGeometry *geometry, string filename, bool surf_sol, bool write_data) {
+  
+  unsigned short iDim, iList, nList, iNode, nDim = geometry->GetnDim();
+  unsigned long iPoint, iElem, iCell, iField, iConn, nPoint_Out, nCell_Out = 0, nConn_Out = 0;
+  unsigned long *LocalIndex = NULL;
+  bool xml_format = (config->GetOutput_FileFormat() == PARAVIEW_XML);
+  bool compress = xml_format && config->GetOutput_Compression();
+  bool sol_coords = ((config->GetKind_SU2() == SU2_SOL) || (config->GetKind_SU2() == SU2_DOT));
+  su2double **Coord_Out = sol_coords ? Data : Coords;
+  
+  int *Conn_List[6];
+  unsigned long nElem_List[6];
+  unsigned short nNode_List[6], Type_List[6];
+  
+  vector<string> FieldNames;
+  vector<unsigned short> FieldIndex;
+  
+  /*--- Element lists (connectivity, number of elements, nodes per
+   element and VTK cell type) of the surface or volume output. ---*/
+  
+  if (surf_sol) {
+    nList = 3;
+    Conn_List[0] = Conn_Line;      nElem_List[0] = nGlobal_Line;      nNode_List[0] = N_POINTS_LINE;          Type_List[0] = 3;
+    Conn_List[1] = Conn_BoundTria; nElem_List[1] = nGlobal_BoundTria; nNode_List[1] = N_POINTS_TRIANGLE;      Type_List[1] = 5;
+    Conn_List[2] = Conn_BoundQuad; nElem_List[2] = nGlobal_BoundQuad; nNode_List[2] = N_POINTS_QUADRILATERAL; Type_List[2] = 9;
+  }
+  else {
+    nList = 6;
+    Conn_List[0] = Conn_Tria; nElem_List[0] = nGlobal_Tria; nNode_List[0] = N_POINTS_TRIANGLE;      Type_List[0] = 5;
+    Conn_List[1] = Conn_Quad; nElem_List[1] = nGlobal_Quad; nNode_List[1] = N_POINTS_QUADRILATERAL; Type_List[1] = 9;
+    Conn_List[2] = Conn_Tetr; nElem_List[2] = nGlobal_Tetr; nNode_List[2] = N_POINTS_TETRAHEDRON;   Type_List[2] = 10;
+    Conn_List[3] = Conn_Hexa; nElem_List[3] = nGlobal_Hexa; nNode_List[3] = N_POINTS_HEXAHEDRON;    Type_List[3] = 12;
+    Conn_List[4] = Conn_Pris; nElem_List[4] = nGlobal_Pris; nNode_List[4] = N_POINTS_PRISM;         Type_List[4] = 13;
+    Conn_List[5] = Conn_Pyra; nElem_List[5] = nGlobal_Pyra; nNode_List[5] = N_POINTS_PYRAMID;       Type_List[5] = 14;
+  }
+  
+  for (iList = 0; iList < nList; iList++) {
+    nCell_Out += nElem_List[iList];
+    nConn_Out += nElem_List[iList]*nNode_List[iList];
+  }
+  
+  /*--- Local (1-based) numbering of the written points. For surface output only
+   the points that belong to the surface elements are written. ---*/
+  
+  LocalIndex = new unsigned long [nGlobal_Poin+1];
+  
+  if (surf_sol) {
+    for (iPoint = 0; iPoint < nGlobal_Poin+1; iPoint++) LocalIndex[iPoint] = 0;
+    for (iList = 0; iList < nList; iList++)
+      for (iConn = 0; iConn < nElem_List[iList]*nNode_List[iList]; iConn++)
+        LocalIndex[Conn_List[iList][iConn]] = 1;
+    nPoint_Out = 0;
+    for (iPoint = 0; iPoint < nGlobal_Poin+1; iPoint++)
+      if (LocalIndex[iPoint] != 0) { nPoint_Out++; LocalIndex[iPoint] = nPoint_Out; }
+    nSurf_Poin = nPoint_Out;
+  }
+  else {
+    for (iPoint = 0; iPoint < nGlobal_Poin+1; iPoint++) LocalIndex[iPoint] = iPoint;
+    nPoint_Out = nGlobal_Poin;
+  }
+  
+  /*--- Fill the point coordinates (always 3 components). ---*/
+  
+  vector<float> Point_Buffer(3*nPoint_Out, 0.0);
+  for (iPoint = 0; iPoint < nGlobal_Poin; iPoint++) {
+    if (LocalIndex[iPoint+1] == 0) continue;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Point_Buffer[3*(LocalIndex[iPoint+1]-1)+iDim] = float(SU2_TYPE::GetValue(Coord_Out[iDim][iPoint]));
+  }
+  
+  /*--- Fill the connectivity, offsets and cell types. ---*/
+  
+  vector<int> Conn_Buffer(nConn_Out), Offset_Buffer(nCell_Out);
+  vector<unsigned char> Type_Buffer(nCell_Out);
+  
+  iCell = 0; iConn = 0;
+  for (iList = 0; iList < nList; iList++) {
+    for (iElem = 0; iElem < nElem_List[iList]; iElem++) {
+      for (iNode = 0; iNode < nNode_List[iList]; iNode++) {
+        Conn_Buffer[iConn] = int(LocalIndex[Conn_List[iList][iElem*nNode_List[iList]+iNode]]) - 1;
+        iConn++;
+      }
+      Offset_Buffer[iCell] = int(iConn);
+      Type_Buffer[iCell] = Type_List[iList];
+      iCell++;
+    }
+  }
+  
+  /*--- Fill the point data, one contiguous block per variable. ---*/
+  
+  if (write_data) SetParaview_FieldNames(config, geometry, FieldNames, FieldIndex);
+  
+  vector<vector<float> > Field_Buffer(FieldNames.size(), vector<float>(nPoint_Out));
+  for (iField = 0; iField < FieldNames.size(); iField++) {
+    for (iPoint = 0; iPoint < nGlobal_Poin; iPoint++) {
+      if (LocalIndex[iPoint+1] == 0) continue;
+      Field_Buffer[iField][LocalIndex[iPoint+1]-1] = float(SU2_TYPE::GetValue(Data[FieldIndex[iField]][iPoint]));
+    }
+  }
+  
+  delete [] LocalIndex;
+  
+  ofstream Paraview_File;
+  Paraview_File.open(filename.c_str(), ios::out | ios::binary);
+  
+  if (!xml_format) {
+    
+    /*--- Legacy VTK binary file: ASCII keywords followed by big endian blocks. ---*/
+    
+    vector<int> Cell_Buffer(nCell_Out + nConn_Out);
+    iConn = 0;
+    for (iCell = 0; iCell < nCell_Out; iCell++) {
+      unsigned long Start = (iCell == 0) ? 0 : Offset_Buffer[iCell-1];
+      Cell_Buffer[iConn++] = Offset_Buffer[iCell] - int(Start);
+      for (unsigned long jConn = Start; jConn < (unsigned long)Offset_Buffer[iCell]; jConn++)
+        Cell_Buffer[iConn++] = Conn_Buffer[jConn];
+    }
+    vector<int> CellType_Buffer(Type_Buffer.begin(), Type_Buffer.end());
+    
+    Paraview_File << "# vtk DataFile Version 3.0\n";
+    Paraview_File << "vtk output\n";
+    Paraview_File << "BINARY\n";
+    Paraview_File << "DATASET UNSTRUCTURED_GRID\n";
+    
+    Paraview_File << "POINTS " << nPoint_Out << " float\n";
+    WriteLegacy_Block(Paraview_File, &Point_Buffer[0], sizeof(float), Point_Buffer.size());
+    
+    Paraview_File << "CELLS " << nCell_Out << " " << Cell_Buffer.size() << "\n";
+    WriteLegacy_Block(Paraview_File, &Cell_Buffer[0], sizeof(int), Cell_Buffer.size());
+    
+    Paraview_File << "CELL_TYPES " << nCell_Out << "\n";
+    WriteLegacy_Block(Paraview_File, &CellType_Buffer[0], sizeof(int), CellType_Buffer.size());
+    
+    if (!FieldNames.empty()) {
+      Paraview_File << "POINT_DATA " << nPoint_Out << "\n";
+      for (iField = 0; iField < FieldNames.size(); iField++) {
+        Paraview_File << "SCALARS " << FieldNames[iField] << " float 1\n";
+        Paraview_File << "LOOKUP_TABLE default\n";
+        WriteLegacy_Block(Paraview_File, &Field_Buffer[iField][0], sizeof(float), nPoint_Out);
+      }
+    }
+    
+  }
+  else {
+    
+    /*--- XML VTK file (.vtu) with all the arrays in a raw appended section.
+     The arrays are encoded first, so that their offsets are known. ---*/
+    
+    vector<vector<char> > Blocks(4 + FieldNames.size());
+    vector<uint64_t> Offset(Blocks.size(), 0);
+    
+    EncodeAppended_Block(&Point_Buffer[0], Point_Buffer.size()*sizeof(float), compress, Blocks[0]);
+    EncodeAppended_Block(&Conn_Buffer[0], Conn_Buffer.size()*sizeof(int), compress, Blocks[1]);
+    EncodeAppended_Block(&Offset_Buffer[0], Offset_Buffer.size()*sizeof(int), compress, Blocks[2]);
+    EncodeAppended_Block(&Type_Buffer[0], Type_Buffer.size()*sizeof(unsigned char), compress, Blocks[3]);
+    for (iField = 0; iField < FieldNames.size(); iField++)
+      EncodeAppended_Block(&Field_Buffer[iField][0], nPoint_Out*sizeof(float), compress, Blocks[4+iField]);
+    
+    for (iField = 1; iField < Blocks.size(); iField++)
+      Offset[iField] = Offset[iField-1] + Blocks[iField-1].size();
+    
+    Paraview_File << "<?xml version=\"1.0\"?>\n";
+    Paraview_File << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+                  << (IsBigEndian() ? "BigEndian" : "LittleEndian") << "\" header_type=\"UInt64\"";
+    if (compress) Paraview_File << " compressor=\"vtkZLibDataCompressor\"";
+    Paraview_File << ">\n";
+    Paraview_File << "  <UnstructuredGrid>\n";
+    Paraview_File << "    <Piece NumberOfPoints=\"" << nPoint_Out << "\" NumberOfCells=\"" << nCell_Out << "\">\n";
+    Paraview_File << "      <Points>\n";
+    Paraview_File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << Offset[0] << "\"/>\n";
+    Paraview_File << "      </Points>\n";
+    Paraview_File << "      <Cells>\n";
+    Paraview_File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"" << Offset[1] << "\"/>\n";
+    Paraview_File << "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"" << Offset[2] << "\"/>\n";
+    Paraview_File << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << Offset[3] << "\"/>\n";
+    Paraview_File << "      </Cells>\n";
+    Paraview_File << "      <PointData>\n";
+    for (iField = 0; iField < FieldNames.size(); iField++)
+      Paraview_File << "        <DataArray type=\"Float32\" Name=\"" << FieldNames[iField] << "\" format=\"appended\" offset=\"" << Offset[4+iField] << "\"/>\n";
+    Paraview_File << "      </PointData>\n";
+    Paraview_File << "    </Piece>\n";
+    Paraview_File << "  </UnstructuredGrid>\n";
+    Paraview_File << "  <AppendedData encoding=\"raw\">\n";
+    Paraview_File << "_";
+    for (iField = 0; iField < Blocks.size(); iField++)
+      Paraview_File.write(&Blocks[iField][0], Blocks[iField].size());
+    Paraview_File << "\n  </AppendedData>\n";
+    Paraview_File << "</VTKFile>\n";
+    
+  }
+  
+  Paraview_File.close();
+  
+}
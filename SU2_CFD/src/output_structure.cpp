@@ -3676,8 +3676,16 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   bool grid_movement = config->GetGrid_Movement();
   bool dynamic_fem = (config->GetDynamic_Analysis() == DYNAMIC);
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
+  bool paraview = ((config->GetOutput_FileFormat() == PARAVIEW) ||
+                   (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+                   (config->GetOutput_FileFormat() == PARAVIEW_XML));
+  bool backup = config->GetWrt_Restart_Backup();
+  bool history = (config->GetUnsteady_History() && config->GetWrt_Unsteady() &&
+                  (config->GetUnsteady_Simulation() != TIME_SPECTRAL) &&
+                  !config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint() && !fem);
   ofstream restart_file;
-  string filename;
+  ostringstream restart_header;
+  string filename, tmp_filename, history_filename;
   
   /*--- Retrieve filename from config ---*/
   
@@ -3693,6 +3701,7 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   /*--- Append the zone number if multizone problems ---*/
   if (nZone > 1)
     filename= config->GetMultizone_FileName(filename, val_iZone);
+  history_filename = filename;
   
   /*--- Unsteady problems require an iteration number to be appended. ---*/
   if (config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
@@ -3703,40 +3712,35 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
   
-  /*--- Open the restart file and write the solution. ---*/
-  
-  restart_file.open(filename.c_str(), ios::out);
-  restart_file.precision(15);
-  
   /*--- Write the header line based on the particular solver ----*/
   
-  restart_file << "\"PointID\"";
+  restart_header << "\"PointID\"";
   
   /*--- Mesh coordinates are always written to the restart first ---*/
   
   if (nDim == 2) {
-    restart_file << "\t\"x\"\t\"y\"";
+    restart_header << "\t\"x\"\t\"y\"";
   } else {
-    restart_file << "\t\"x\"\t\"y\"\t\"z\"";
+    restart_header << "\t\"x\"\t\"y\"\t\"z\"";
   }
   
   for (iVar = 0; iVar < nVar_Consv; iVar++) {
     if ( Kind_Solver == FEM_ELASTICITY )
-      restart_file << "\t\"Displacement_" << iVar+1<<"\"";
+      restart_header << "\t\"Displacement_" << iVar+1<<"\"";
     else
-      restart_file << "\t\"Conservative_" << iVar+1<<"\"";
+      restart_header << "\t\"Conservative_" << iVar+1<<"\"";
   }
   
   if (!config->GetLow_MemoryOutput()) {
     
     if (config->GetWrt_Limiters()) {
       for (iVar = 0; iVar < nVar_Consv; iVar++) {
-        restart_file << "\t\"Limiter_" << iVar+1<<"\"";
+        restart_header << "\t\"Limiter_" << iVar+1<<"\"";
       }
     }
     if (config->GetWrt_Residuals()) {
       for (iVar = 0; iVar < nVar_Consv; iVar++) {
-        restart_file << "\t\"Residual_" << iVar+1<<"\"";
+        restart_header << "\t\"Residual_" << iVar+1<<"\"";
       }
     }
     
@@ -3744,82 +3748,82 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     
     if (grid_movement && !fem) {
       if (nDim == 2) {
-        restart_file << "\t\"Grid_Velx\"\t\"Grid_Vely\"";
+        restart_header << "\t\"Grid_Velx\"\t\"Grid_Vely\"";
       } else {
-        restart_file << "\t\"Grid_Velx\"\t\"Grid_Vely\"\t\"Grid_Velz\"";
+        restart_header << "\t\"Grid_Velx\"\t\"Grid_Vely\"\t\"Grid_Velz\"";
       }
     }
     
     /*--- Solver specific output variables ---*/
     
     if (config->GetKind_Regime() == FREESURFACE) {
-      restart_file << "\t\"Density\"";
+      restart_header << "\t\"Density\"";
     }
     
     if ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
-        restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"Pressure_Coefficient\"\t\"Mach\"";
+      if (paraview) {
+        restart_header << "\t\"Pressure\"\t\"Temperature\"\t\"Pressure_Coefficient\"\t\"Mach\"";
       } else
-        restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"C<sub>p</sub>\"\t\"Mach\"";
+        restart_header << "\t\"Pressure\"\t\"Temperature\"\t\"C<sub>p</sub>\"\t\"Mach\"";
     }
     
     if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
-        if (nDim == 2) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Heat_Flux\"\t\"Y_Plus\"";
-        if (nDim == 3) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Skin_Friction_Coefficient_Z\"\t\"Heat_Flux\"\t\"Y_Plus\"";
+      if (paraview) {
+        if (nDim == 2) restart_header << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Heat_Flux\"\t\"Y_Plus\"";
+        if (nDim == 3) restart_header << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Skin_Friction_Coefficient_Z\"\t\"Heat_Flux\"\t\"Y_Plus\"";
       } else {
-        if (nDim == 2) restart_file << "\t\"<greek>m</greek>\"\t\"C<sub>f</sub>_x\"\t\"C<sub>f</sub>_y\"\t\"h\"\t\"y<sup>+</sup>\"";
-        if (nDim == 3) restart_file << "\t\"<greek>m</greek>\"\t\"C<sub>f</sub>_x\"\t\"C<sub>f</sub>_y\"\t\"C<sub>f</sub>_z\"\t\"h\"\t\"y<sup>+</sup>\"";
+        if (nDim == 2) restart_header << "\t\"<greek>m</greek>\"\t\"C<sub>f</sub>_x\"\t\"C<sub>f</sub>_y\"\t\"h\"\t\"y<sup>+</sup>\"";
+        if (nDim == 3) restart_header << "\t\"<greek>m</greek>\"\t\"C<sub>f</sub>_x\"\t\"C<sub>f</sub>_y\"\t\"C<sub>f</sub>_z\"\t\"h\"\t\"y<sup>+</sup>\"";
       }
     }
     
     if (Kind_Solver == RANS) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
-        restart_file << "\t\"Eddy_Viscosity\"";
+      if (paraview) {
+        restart_header << "\t\"Eddy_Viscosity\"";
       } else
-        restart_file << "\t\"<greek>m</greek><sub>t</sub>\"";
+        restart_header << "\t\"<greek>m</greek><sub>t</sub>\"";
     }
     
     if (config->GetWrt_SharpEdges()) {
       if ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-        restart_file << "\t\"Sharp_Edge_Dist\"";
+        restart_header << "\t\"Sharp_Edge_Dist\"";
       }
     }
     
     if (Kind_Solver == POISSON_EQUATION) {
       for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
-        restart_file << "\t\"poissonField_" << iDim+1 << "\"";
+        restart_header << "\t\"poissonField_" << iDim+1 << "\"";
     }
     
     if ((Kind_Solver == ADJ_EULER              ) ||
         (Kind_Solver == ADJ_NAVIER_STOKES      ) ||
         (Kind_Solver == ADJ_RANS               )   ) {
-      restart_file << "\t\"Surface_Sensitivity\"\t\"Solution_Sensor\"";
+      restart_header << "\t\"Surface_Sensitivity\"\t\"Solution_Sensor\"";
     }
     if (( Kind_Solver == DISC_ADJ_EULER              ) ||
         ( Kind_Solver == DISC_ADJ_NAVIER_STOKES      ) ||
         ( Kind_Solver == DISC_ADJ_RANS               )) {
-      restart_file << "\t\"Surface_Sensitivity\"\t\"Sensitivity_x\"\t\"Sensitivity_y\"";
+      restart_header << "\t\"Surface_Sensitivity\"\t\"Sensitivity_x\"\t\"Sensitivity_y\"";
       if (geometry->GetnDim() == 3){
-        restart_file << "\t\"Sensitivity_z\"";
+        restart_header << "\t\"Sensitivity_z\"";
       }
     }
     
     if (Kind_Solver == FEM_ELASTICITY) {
       if (!dynamic_fem) {
         if (geometry->GetnDim() == 2)
-          restart_file << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Von_Mises_Stress\"";
+          restart_header << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Von_Mises_Stress\"";
         if (geometry->GetnDim() == 3)
-          restart_file << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Szz\"\t\"Sxz\"\t\"Syz\"\t\"Von_Mises_Stress\"";
+          restart_header << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Szz\"\t\"Sxz\"\t\"Syz\"\t\"Von_Mises_Stress\"";
       }
       else if (dynamic_fem) {
         if (geometry->GetnDim() == 2){
-          restart_file << "\t\"Velocity_1\"\t\"Velocity_2\"\t\"Acceleration_1\"\t\"Acceleration_2\"";
-          restart_file << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Von_Mises_Stress\"";
+          restart_header << "\t\"Velocity_1\"\t\"Velocity_2\"\t\"Acceleration_1\"\t\"Acceleration_2\"";
+          restart_header << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Von_Mises_Stress\"";
         }
         if (geometry->GetnDim() == 3){
-          restart_file << "\t\"Velocity_1\"\t\"Velocity_2\"\t\"Velocity_3\"\t\"Acceleration_1\"\t\"Acceleration_2\"\t\"Acceleration_3\"";
-          restart_file << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Szz\"\t\"Sxz\"\t\"Syz\"\t\"Von_Mises_Stress\"";
+          restart_header << "\t\"Velocity_1\"\t\"Velocity_2\"\t\"Velocity_3\"\t\"Acceleration_1\"\t\"Acceleration_2\"\t\"Acceleration_3\"";
+          restart_header << "\t\"Sxx\"\t\"Syy\"\t\"Sxy\"\t\"Szz\"\t\"Sxz\"\t\"Syz\"\t\"Von_Mises_Stress\"";
         }
       }
     }
@@ -3833,15 +3837,36 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
       
       for (iVar = 0; iVar < nVar_Extra; iVar++) {
         if (headings == NULL) {
-          restart_file << "\t\"ExtraOutput_" << iVar+1<<"\"";
+          restart_header << "\t\"ExtraOutput_" << iVar+1<<"\"";
         } else{
-          restart_file << "\t\""<< headings[iVar] <<"\"";
+          restart_header << "\t\""<< headings[iVar] <<"\"";
         }
       }
     }
   }
   
-  restart_file << "\n";
+  /*--- Unsteady flow solutions can be stored as a record of a single
+   container file instead of one restart file per time step. ---*/
+  
+  if (history) {
+    CUnsteadyHistory history_file(config, history_filename, long(iExtIter));
+    history_file.WriteRecord(long(iExtIter), restart_header.str(), Coords, nDim, Data, nVar_Total,
+                             geometry->GetGlobal_nPointDomain());
+    return;
+  }
+  
+  /*--- With the backup option the solution goes to a temporary file first,
+   so that a crash during the output never leaves a truncated restart. ---*/
+  
+  tmp_filename = filename;
+  if (backup) tmp_filename = filename + ".tmp";
+  
+  /*--- Open the restart file and write the solution. ---*/
+  
+  restart_file.open(tmp_filename.c_str(), ios::out);
+  restart_file.precision(15);
+  
+  restart_file << restart_header.str() << "\n";
   
   /*--- Write the restart file ---*/
   
@@ -3864,6 +3889,19 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   
   restart_file.close();
   
+  /*--- Keep the previous restart as a backup and move the new one in place ---*/
+  
+  if (backup) {
+    if (restart_file.fail()) {
+      cout << "WARNING: Unable to write " << tmp_filename << ", the previous restart file is kept." << endl;
+    }
+    else {
+      rename(filename.c_str(), (filename + ".bak").c_str());
+      if (rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        cout << "WARNING: Unable to rename " << tmp_filename << " to " << filename << "." << endl;
+    }
+  }
+  
 }
 
 void COutput::DeallocateCoordinates(CConfig *config, CGeometry *geometry) {
@@ -3979,7 +4017,9 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
       (config->GetOutput_FileFormat() == FIELDVIEW)) SPRINTF (buffer, ".dat");
   else if ((config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
            (config->GetOutput_FileFormat() == FIELDVIEW_BINARY))  SPRINTF (buffer, ".plt");
-  else if (config->GetOutput_FileFormat() == PARAVIEW)  SPRINTF (buffer, ".csv");
+  else if ((config->GetOutput_FileFormat() == PARAVIEW) ||
+           (config->GetOutput_FileFormat() == PARAVIEW_BINARY) ||
+           (config->GetOutput_FileFormat() == PARAVIEW_XML))  SPRINTF (buffer, ".csv");
   strcat(cstr, buffer);
   
   ConvHist_file->open(cstr, ios::out);
@@ -6642,6 +6682,15 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
             DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
             break;
             
+          case PARAVIEW_BINARY: case PARAVIEW_XML:
+            
+            /*--- Write a Paraview binary file ---*/
+            
+            if (rank == MASTER_NODE) cout << "Writing Paraview binary volume solution file." << endl;
+            SetParaview_Binary(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
+            break;
+            
           default:
             break;
         }
@@ -6678,6 +6727,15 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
             DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], true);
             break;
             
+          case PARAVIEW_BINARY: case PARAVIEW_XML:
+            
+            /*--- Write a Paraview binary file ---*/
+            
+            if (rank == MASTER_NODE) cout << "Writing Paraview binary surface solution file." << endl;
+            SetParaview_Binary(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], true);
+            break;
+            
           default:
             break;
         }
@@ -6800,6 +6858,15 @@ void COutput::SetBaselineResult_Files(CSolver **solver, CGeometry **geometry, CC
               DeallocateConnectivity(config[iZone], geometry[iZone], false);
               break;
               
+            case PARAVIEW_BINARY: case PARAVIEW_XML:
+              
+              /*--- Write a Paraview binary file ---*/
+              
+              if (rank == MASTER_NODE) cout << "Writing Paraview binary file (volume grid)." << endl;
+              SetParaview_Binary(config[iZone], geometry[iZone], iZone, val_nZone, false);
+              DeallocateConnectivity(config[iZone], geometry[iZone], false);
+              break;
+              
             default:
               break;
           }
@@ -6837,6 +6904,15 @@ void COutput::SetBaselineResult_Files(CSolver **solver, CGeometry **geometry, CC
               DeallocateConnectivity(config[iZone], geometry[iZone], true);
               break;
               
+            case PARAVIEW_BINARY: case PARAVIEW_XML:
+              
+              /*--- Write a Paraview binary file ---*/
+              
+              if (rank == MASTER_NODE) cout << "Writing Paraview binary file (surface grid)." << endl;
+              SetParaview_Binary(config[iZone], geometry[iZone], iZone, val_nZone, true);
+              DeallocateConnectivity(config[iZone], geometry[iZone], true);
+              break;
+              
             default:
               break;
           }
@@ -6949,6 +7025,8 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
         
         /*--- Write a Tecplot ASCII file ---*/
         if (config[iZone]->GetOutput_FileFormat()==PARAVIEW) SetParaview_MeshASCII(config[iZone], geometry[iZone], iZone,  val_nZone, false,new_file);
+        else if ((config[iZone]->GetOutput_FileFormat()==PARAVIEW_BINARY) || (config[iZone]->GetOutput_FileFormat()==PARAVIEW_XML))
+          SetParaview_MeshBinary(config[iZone], geometry[iZone], iZone,  val_nZone, false,new_file);
         else SetTecplotASCII_Mesh(config[iZone], geometry[iZone], false, new_file);
         
       }
@@ -6959,6 +7037,8 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
         
         /*--- Write a Tecplot ASCII file ---*/
         if (config[iZone]->GetOutput_FileFormat()==PARAVIEW) SetParaview_MeshASCII(config[iZone], geometry[iZone], iZone,  val_nZone, true,new_file);
+        else if ((config[iZone]->GetOutput_FileFormat()==PARAVIEW_BINARY) || (config[iZone]->GetOutput_FileFormat()==PARAVIEW_XML))
+          SetParaview_MeshBinary(config[iZone], geometry[iZone], iZone,  val_nZone, true,new_file);
         else SetTecplotASCII_Mesh(config[iZone], geometry[iZone], true, new_file);
         
         
@@ -0,0 +1,607 @@
+/*!
+ * \file sampling_structure.cpp
+ * \brief Main subroutines of the high-rate sampling of the flow solution.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *
+ * Copyright (C) 2012-2016 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/sampling_structure.hpp"
+
+#include <cstring>
+#include <cstdio>
+#include <map>
+#include <algorithm>
+
+/*--- Layout of the file: file tag, header (dimensions, number of variables,
+ samples and probes), names of the variables, coordinates and area-weighted
+ normals of the samples (zero for the probes), then one record per sampled
+ time step: iteration, physical time and the values, sample by sample. ---*/
+
+static const char Sampling_FileTag[8] = {'S','U','2','S','M','P','L','1'};
+
+/*--- Decomposition of the elements in simplices (VTK ordering of the nodes) ---*/
+
+static const unsigned short Sampling_Triangle[1][4]      = {{0,1,2,0}};
+static const unsigned short Sampling_Quadrilateral[2][4] = {{0,1,2,0}, {0,2,3,0}};
+static const unsigned short Sampling_Tetrahedron[1][4]   = {{0,1,2,3}};
+static const unsigned short Sampling_Hexahedron[6][4]    = {{0,1,2,6}, {0,2,3,6}, {0,1,5,6},
+                                                            {0,4,5,6}, {0,3,7,6}, {0,4,7,6}};
+static const unsigned short Sampling_Prism[3][4]         = {{0,1,2,5}, {0,1,5,4}, {0,4,5,3}};
+static const unsigned short Sampling_Pyramid[2][4]       = {{0,1,2,4}, {0,2,3,4}};
+
+/*!
+ * \brief Distance to the nearest point and rank (MPI_DOUBLE_INT pair).
+ */
+struct CSamplingNearest {
+  double Dist;   /*!< \brief Distance to the nearest point of the rank. */
+  int Rank;      /*!< \brief Rank of the point. */
+};
+
+CSampling::CSampling(CGeometry *geometry, CConfig *config) {
+
+  unsigned long iProbe, iPoint, iVertex, iLocal, iSample, iLine, iPlane, i, j, n, m, nSurface;
+  unsigned short iDim, iVar, iMarker, iMarker_Sample, iDonor;
+  su2double Coord[3], Dist, *Normal;
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor;
+  vector<su2double> Probe_Coord, Local_Coord, Local_Normal;
+  map<unsigned long, unsigned long> Surface_Sample;
+  map<unsigned long, unsigned long>::iterator it;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  nDim = geometry->GetnDim();
+  nVar = nDim+2;
+  nBuffered = 0;
+
+  /*--- The samples of a restarted unsteady simulation go to a new file,
+   sample.bin becomes sample_00100.bin ---*/
+
+  FileName = config->GetSample_FileName();
+  if (config->GetWrt_Unsteady() && config->GetRestart()) {
+    char buffer[50];
+    string::size_type position = FileName.find_last_of(".");
+    SPRINTF (buffer, "_%05d", SU2_TYPE::Int(config->GetUnst_RestartIter()));
+    if (position == string::npos) FileName.append(string(buffer));
+    else FileName.insert(position, string(buffer));
+  }
+
+  /*--- Probes, then the points of the lines and of the planes ---*/
+
+  su2double *Probes = config->GetSample_Probes(), *Lines = config->GetSample_Lines(),
+  *Planes = config->GetSample_Planes();
+
+  for (iProbe = 0; iProbe < config->GetnSample_Probes()/3; iProbe++)
+    for (iDim = 0; iDim < 3; iDim++)
+      Probe_Coord.push_back(Probes[3*iProbe+iDim]);
+
+  for (iLine = 0; iLine < config->GetnSample_Lines()/7; iLine++) {
+    n = max(SU2_TYPE::Int(Lines[7*iLine+6]), 2);
+    for (i = 0; i < n; i++)
+      for (iDim = 0; iDim < 3; iDim++)
+        Probe_Coord.push_back(Lines[7*iLine+iDim] + (Lines[7*iLine+3+iDim]-Lines[7*iLine+iDim])*su2double(i)/su2double(n-1));
+  }
+
+  for (iPlane = 0; iPlane < config->GetnSample_Planes()/11; iPlane++) {
+    n = max(SU2_TYPE::Int(Planes[11*iPlane+9]), 2);
+    m = max(SU2_TYPE::Int(Planes[11*iPlane+10]), 2);
+    for (j = 0; j < m; j++)
+      for (i = 0; i < n; i++)
+        for (iDim = 0; iDim < 3; iDim++)
+          Probe_Coord.push_back(Planes[11*iPlane+iDim] + Planes[11*iPlane+3+iDim]*su2double(i)/su2double(n-1)
+                                + Planes[11*iPlane+6+iDim]*su2double(j)/su2double(m-1));
+  }
+
+  nProbe = Probe_Coord.size()/3;
+
+  /*--- Locate the probes. A probe is interpolated by the lowest rank that
+   contains it, the probes outside of the domain take the value of the
+   nearest point. ---*/
+
+  SetBins(geometry);
+
+  vector<int> Owner_Local(nProbe, size), Owner(nProbe, size);
+  vector<vector<unsigned long> > Probe_Point(nProbe);
+  vector<vector<su2double> > Probe_Weight(nProbe);
+
+  for (iProbe = 0; iProbe < nProbe; iProbe++) {
+    for (iDim = 0; iDim < 3; iDim++) Coord[iDim] = Probe_Coord[3*iProbe+iDim];
+    if (FindElement(geometry, Coord, Probe_Point[iProbe], Probe_Weight[iProbe]))
+      Owner_Local[iProbe] = rank;
+  }
+
+#ifdef HAVE_MPI
+  if (nProbe > 0)
+    SU2_MPI::Allreduce(&Owner_Local[0], &Owner[0], int(nProbe), MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#else
+  Owner = Owner_Local;
+#endif
+
+  CSamplingNearest *Nearest_Local = NULL, *Nearest = NULL;
+  vector<unsigned long> Nearest_Point(nProbe, 0);
+  unsigned long nOutside = 0;
+
+  for (iProbe = 0; iProbe < nProbe; iProbe++)
+    if (Owner[iProbe] == size) nOutside++;
+
+  if (nOutside > 0) {
+    Nearest_Local = new CSamplingNearest [nProbe];
+    Nearest = Nearest_Local;
+    for (iProbe = 0; iProbe < nProbe; iProbe++) {
+      Nearest_Local[iProbe].Dist = 1E300; Nearest_Local[iProbe].Rank = rank;
+      if (Owner[iProbe] != size) continue;
+      for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+        Dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Dist += pow(geometry->node[iPoint]->GetCoord(iDim)-Probe_Coord[3*iProbe+iDim], 2.0);
+        if (SU2_TYPE::GetValue(Dist) < Nearest_Local[iProbe].Dist) {
+          Nearest_Local[iProbe].Dist = SU2_TYPE::GetValue(Dist);
+          Nearest_Point[iProbe] = iPoint;
+        }
+      }
+    }
+#ifdef HAVE_MPI
+    Nearest = new CSamplingNearest [nProbe];
+    SU2_MPI::Allreduce(Nearest_Local, Nearest, int(nProbe), MPI_DOUBLE_INT, MPI_MINLOC, MPI_COMM_WORLD);
+#endif
+    for (iProbe = 0; iProbe < nProbe; iProbe++) {
+      if (Owner[iProbe] != size) continue;
+      if (rank == MASTER_NODE)
+        cout << "WARNING: Sample " << iProbe << " is outside of the domain, the nearest point is used." << endl;
+      if (Nearest[iProbe].Rank == rank) {
+        Owner[iProbe] = rank;
+        Probe_Point[iProbe].assign(1, Nearest_Point[iProbe]);
+        Probe_Weight[iProbe].assign(1, 1.0);
+      }
+    }
+  }
+
+  Donor_Begin.push_back(0);
+
+  for (iProbe = 0; iProbe < nProbe; iProbe++) {
+    if (Owner[iProbe] != rank) continue;
+    for (iDonor = 0; iDonor < Probe_Point[iProbe].size(); iDonor++) {
+      Donor_Point.push_back(Probe_Point[iProbe][iDonor]);
+      Donor_Weight.push_back(Probe_Weight[iProbe][iDonor]);
+    }
+    Donor_Begin.push_back(Donor_Point.size());
+    Local_Key.push_back(iProbe);
+    for (iDim = 0; iDim < 3; iDim++) {
+      Local_Coord.push_back(Probe_Coord[3*iProbe+iDim]);
+      Local_Normal.push_back(0.0);
+    }
+  }
+
+  /*--- The points of the sampled surfaces, owned by the rank where they
+   belong to the domain. A point shared by two markers is sampled once. ---*/
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    for (iMarker_Sample = 0; iMarker_Sample < config->GetnMarker_Sample(); iMarker_Sample++) {
+      if (config->GetMarker_All_TagBound(iMarker) != config->GetMarker_Sample(iMarker_Sample)) continue;
+      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->node[iPoint]->GetDomain()) continue;
+        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        it = Surface_Sample.find(iPoint);
+        if (it == Surface_Sample.end()) {
+          iLocal = Local_Key.size();
+          Surface_Sample[iPoint] = iLocal;
+          Donor_Point.push_back(iPoint);
+          Donor_Weight.push_back(1.0);
+          Donor_Begin.push_back(Donor_Point.size());
+          Local_Key.push_back(nProbe + geometry->node[iPoint]->GetGlobalIndex());
+          for (iDim = 0; iDim < 3; iDim++) {
+            Local_Coord.push_back((iDim < nDim) ? geometry->node[iPoint]->GetCoord(iDim) : 0.0);
+            Local_Normal.push_back(0.0);
+          }
+        }
+        else iLocal = it->second;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Local_Normal[3*iLocal+iDim] += Normal[iDim];
+      }
+    }
+  }
+
+  nLocal = Local_Key.size();
+
+  /*--- The location of the samples is not needed anymore ---*/
+
+  Bin_Begin.clear(); Bin_Elem.clear();
+  if (Nearest != Nearest_Local) delete [] Nearest;
+  if (Nearest_Local != NULL) delete [] Nearest_Local;
+
+  /*--- Gather the keys, coordinates and normals of the samples on the master
+   node, which stores the position in the file of the samples of each rank.
+   The buffers have the size of the largest rank (same as the restart files). ---*/
+
+  nMaxLocal = nLocal;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nLocal, &nMaxLocal, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  vector<unsigned long> Buffer_Send_Key(nMaxLocal+1, 0), Buffer_Recv_Key;
+  vector<passivedouble> Buffer_Send_Geo(6*nMaxLocal+1, 0.0), Buffer_Recv_Geo;
+
+  Buffer_Send_Key[0] = nLocal;
+  for (iLocal = 0; iLocal < nLocal; iLocal++) {
+    Buffer_Send_Key[iLocal+1] = Local_Key[iLocal];
+    for (iDim = 0; iDim < 3; iDim++) {
+      Buffer_Send_Geo[6*iLocal+iDim]   = SU2_TYPE::GetValue(Local_Coord[3*iLocal+iDim]);
+      Buffer_Send_Geo[6*iLocal+3+iDim] = SU2_TYPE::GetValue(Local_Normal[3*iLocal+iDim]);
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    Buffer_Recv_Key.resize(size*(nMaxLocal+1));
+    Buffer_Recv_Geo.resize(size*(6*nMaxLocal+1));
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Gather(&Buffer_Send_Key[0], int(nMaxLocal+1), MPI_UNSIGNED_LONG, rank == MASTER_NODE ? &Buffer_Recv_Key[0] : NULL,
+                  int(nMaxLocal+1), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(&Buffer_Send_Geo[0], int(6*nMaxLocal+1), MPI_DOUBLE, rank == MASTER_NODE ? &Buffer_Recv_Geo[0] : NULL,
+                  int(6*nMaxLocal+1), MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  Buffer_Recv_Key = Buffer_Send_Key;
+  Buffer_Recv_Geo = Buffer_Send_Geo;
+#endif
+
+  nSample = nProbe;
+
+  if (rank == MASTER_NODE) {
+
+    /*--- The surface points are sorted by global index ---*/
+
+    map<unsigned long, unsigned long> Surface_Position;
+    for (iProcessor = 0; iProcessor < size; iProcessor++)
+      for (iLocal = 0; iLocal < Buffer_Recv_Key[iProcessor*(nMaxLocal+1)]; iLocal++)
+        if (Buffer_Recv_Key[iProcessor*(nMaxLocal+1)+1+iLocal] >= nProbe)
+          Surface_Position[Buffer_Recv_Key[iProcessor*(nMaxLocal+1)+1+iLocal]] = 0;
+
+    nSurface = 0;
+    for (it = Surface_Position.begin(); it != Surface_Position.end(); it++, nSurface++)
+      it->second = nProbe + nSurface;
+    nSample = nProbe + nSurface;
+
+    Sample_Position.assign(size*nMaxLocal, nSample);
+    vector<passivedouble> Sample_Geo(6*nSample, 0.0);
+
+    for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      for (iLocal = 0; iLocal < Buffer_Recv_Key[iProcessor*(nMaxLocal+1)]; iLocal++) {
+        unsigned long Key = Buffer_Recv_Key[iProcessor*(nMaxLocal+1)+1+iLocal];
+        iSample = (Key < nProbe) ? Key : Surface_Position[Key];
+        Sample_Position[iProcessor*nMaxLocal+iLocal] = iSample;
+        for (iDim = 0; iDim < 6; iDim++)
+          Sample_Geo[6*iSample+iDim] = Buffer_Recv_Geo[iProcessor*(6*nMaxLocal+1)+6*iLocal+iDim];
+      }
+    }
+
+    /*--- Write the header of the file ---*/
+
+    ofstream Sample_File(FileName.c_str(), ios::out | ios::binary | ios::trunc);
+    if (!Sample_File.is_open()) {
+      cout << "There is no sampling file " << FileName << "!!" << endl;
+      exit(EXIT_FAILURE);
+    }
+
+    int Header[2] = {nDim, nVar};
+    unsigned long Size[2] = {nSample, nProbe};
+    char Name[32];
+    Sample_File.write(Sampling_FileTag, sizeof(Sampling_FileTag));
+    Sample_File.write((char *)Header, sizeof(Header));
+    Sample_File.write((char *)Size, sizeof(Size));
+    for (iVar = 0; iVar < nVar; iVar++) {
+      memset(Name, 0, sizeof(Name));
+      if (iVar == 0) strcpy(Name, "Density");
+      else if (iVar == nVar-1) strcpy(Name, "Pressure");
+      else SPRINTF(Name, "%c-Velocity", char('X'+iVar-1));
+      Sample_File.write(Name, sizeof(Name));
+    }
+    for (iSample = 0; iSample < nSample; iSample++)
+      Sample_File.write((char *)&Sample_Geo[6*iSample], 3*sizeof(passivedouble));
+    for (iSample = 0; iSample < nSample; iSample++)
+      Sample_File.write((char *)&Sample_Geo[6*iSample+3], 3*sizeof(passivedouble));
+    Sample_File.close();
+
+    cout << "Sampling " << nProbe << " probes and " << nSurface << " surface points every "
+    << config->GetSample_Freq() << " iterations (" << FileName << ")." << endl;
+
+  }
+
+}
+
+CSampling::~CSampling(void) {
+
+  /*--- Write the time steps that remain in the buffer ---*/
+
+  if (nBuffered > 0) Flush();
+
+}
+
+unsigned long CSampling::GetnSample(void) { return nSample; }
+
+void CSampling::SetBins(CGeometry *geometry) {
+
+  unsigned long iPoint, iElem, iBin, nBin_Total, i, j, k, nElem = geometry->GetnElem();
+  unsigned long Elem_Min[3], Elem_Max[3];
+  unsigned short iDim, iNode;
+  su2double Coord_Max[3], Coord, Elem_Coord_Min[3], Elem_Coord_Max[3];
+
+  for (iDim = 0; iDim < 3; iDim++) {
+    Bin_Min[iDim] = 0.0; Coord_Max[iDim] = 0.0;
+    Bin_Size[iDim] = 1.0; nBin[iDim] = 1;
+  }
+
+  if (geometry->GetnPoint() == 0) { Bin_Begin.assign(2, 0); return; }
+
+  /*--- Uniform bins over the bounding box of the partition, about one
+   element per bin ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Bin_Min[iDim] = geometry->node[0]->GetCoord(iDim);
+    Coord_Max[iDim] = Bin_Min[iDim];
+  }
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord = geometry->node[iPoint]->GetCoord(iDim);
+      Bin_Min[iDim] = min(Bin_Min[iDim], Coord);
+      Coord_Max[iDim] = max(Coord_Max[iDim], Coord);
+    }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    nBin[iDim] = max(1, min(256, SU2_TYPE::Int(pow(su2double(nElem), 1.0/su2double(nDim)))));
+    Bin_Size[iDim] = (Coord_Max[iDim]-Bin_Min[iDim])/su2double(nBin[iDim]);
+    if (Bin_Size[iDim] <= 0.0) Bin_Size[iDim] = 1.0;
+  }
+
+  nBin_Total = nBin[0]*nBin[1]*nBin[2];
+  Bin_Begin.assign(nBin_Total+1, 0);
+
+  /*--- Two passes over the elements: count, then fill (CSR storage) ---*/
+
+  for (unsigned short iPass = 0; iPass < 2; iPass++) {
+
+    if (iPass == 1) {
+      for (iBin = 0; iBin < nBin_Total; iBin++) Bin_Begin[iBin+1] += Bin_Begin[iBin];
+      Bin_Elem.resize(Bin_Begin[nBin_Total]);
+    }
+
+    vector<unsigned long> Fill(Bin_Begin.begin(), Bin_Begin.end()-1);
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iDim = 0; iDim < 3; iDim++) { Elem_Min[iDim] = 0; Elem_Max[iDim] = 0; }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Elem_Coord_Min[iDim] = geometry->node[geometry->elem[iElem]->GetNode(0)]->GetCoord(iDim);
+        Elem_Coord_Max[iDim] = Elem_Coord_Min[iDim];
+        for (iNode = 1; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
+          Coord = geometry->node[geometry->elem[iElem]->GetNode(iNode)]->GetCoord(iDim);
+          Elem_Coord_Min[iDim] = min(Elem_Coord_Min[iDim], Coord);
+          Elem_Coord_Max[iDim] = max(Elem_Coord_Max[iDim], Coord);
+        }
+        Elem_Min[iDim] = min(nBin[iDim]-1, (unsigned long)(max(0, SU2_TYPE::Int((Elem_Coord_Min[iDim]-Bin_Min[iDim])/Bin_Size[iDim]))));
+        Elem_Max[iDim] = min(nBin[iDim]-1, (unsigned long)(max(0, SU2_TYPE::Int((Elem_Coord_Max[iDim]-Bin_Min[iDim])/Bin_Size[iDim]))));
+      }
+      for (k = Elem_Min[2]; k <= Elem_Max[2]; k++)
+        for (j = Elem_Min[1]; j <= Elem_Max[1]; j++)
+          for (i = Elem_Min[0]; i <= Elem_Max[0]; i++) {
+            iBin = (k*nBin[1]+j)*nBin[0]+i;
+            if (iPass == 0) Bin_Begin[iBin+1]++;
+            else { Bin_Elem[Fill[iBin]] = iElem; Fill[iBin]++; }
+          }
+    }
+  }
+
+}
+
+bool CSampling::SimplexWeights(CGeometry *geometry, su2double *val_coord, unsigned long *val_node, su2double *val_weight) {
+
+  unsigned short iDim, iNode;
+  su2double Edge[3][3], Dist[3], Det, Eps = 1E-10;
+
+  for (iNode = 0; iNode < nDim; iNode++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Edge[iNode][iDim] = geometry->node[val_node[iNode+1]]->GetCoord(iDim) - geometry->node[val_node[0]]->GetCoord(iDim);
+  for (iDim = 0; iDim < nDim; iDim++)
+    Dist[iDim] = val_coord[iDim] - geometry->node[val_node[0]]->GetCoord(iDim);
+
+  /*--- Barycentric coordinates (Cramer's rule) ---*/
+
+  if (nDim == 2) {
+    Det = Edge[0][0]*Edge[1][1] - Edge[1][0]*Edge[0][1];
+    if (fabs(Det) < 1E-30) return false;
+    val_weight[1] = (Dist[0]*Edge[1][1] - Edge[1][0]*Dist[1])/Det;
+    val_weight[2] = (Edge[0][0]*Dist[1] - Dist[0]*Edge[0][1])/Det;
+  }
+  else {
+    Det = Edge[0][0]*(Edge[1][1]*Edge[2][2]-Edge[1][2]*Edge[2][1])
+    - Edge[0][1]*(Edge[1][0]*Edge[2][2]-Edge[1][2]*Edge[2][0])
+    + Edge[0][2]*(Edge[1][0]*Edge[2][1]-Edge[1][1]*Edge[2][0]);
+    if (fabs(Det) < 1E-30) return false;
+    val_weight[1] = (Dist[0]*(Edge[1][1]*Edge[2][2]-Edge[1][2]*Edge[2][1])
+                     - Dist[1]*(Edge[1][0]*Edge[2][2]-Edge[1][2]*Edge[2][0])
+                     + Dist[2]*(Edge[1][0]*Edge[2][1]-Edge[1][1]*Edge[2][0]))/Det;
+    val_weight[2] = (Edge[0][0]*(Dist[1]*Edge[2][2]-Dist[2]*Edge[2][1])
+                     - Edge[0][1]*(Dist[0]*Edge[2][2]-Dist[2]*Edge[2][0])
+                     + Edge[0][2]*(Dist[0]*Edge[2][1]-Dist[1]*Edge[2][0]))/Det;
+    val_weight[3] = (Edge[0][0]*(Edge[1][1]*Dist[2]-Edge[1][2]*Dist[1])
+                     - Edge[0][1]*(Edge[1][0]*Dist[2]-Edge[1][2]*Dist[0])
+                     + Edge[0][2]*(Edge[1][0]*Dist[1]-Edge[1][1]*Dist[0]))/Det;
+  }
+
+  val_weight[0] = 1.0;
+  for (iNode = 1; iNode <= nDim; iNode++) val_weight[0] -= val_weight[iNode];
+
+  for (iNode = 0; iNode <= nDim; iNode++)
+    if (val_weight[iNode] < -Eps) return false;
+
+  return true;
+
+}
+
+bool CSampling::FindElement(CGeometry *geometry, su2double *val_coord, vector<unsigned long> &val_point, vector<su2double> &val_weight) {
+
+  unsigned long iElem, iBin, Bin[3] = {0, 0, 0}, Node[4];
+  unsigned short iDim, iSimplex, nSimplex, iNode;
+  const unsigned short (*Simplex)[4];
+  su2double Weight[4], Index;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Index = (val_coord[iDim]-Bin_Min[iDim])/Bin_Size[iDim];
+    if ((Index < -1E-6) || (Index > su2double(nBin[iDim])+1E-6)) return false;
+    Bin[iDim] = min(nBin[iDim]-1, (unsigned long)(max(0, SU2_TYPE::Int(Index))));
+  }
+
+  iBin = (Bin[2]*nBin[1]+Bin[1])*nBin[0]+Bin[0];
+  if (iBin+1 >= Bin_Begin.size()) return false;
+
+  for (unsigned long iList = Bin_Begin[iBin]; iList < Bin_Begin[iBin+1]; iList++) {
+    iElem = Bin_Elem[iList];
+    switch (geometry->elem[iElem]->GetVTK_Type()) {
+      case TRIANGLE:      Simplex = Sampling_Triangle;      nSimplex = 1; break;
+      case QUADRILATERAL: Simplex = Sampling_Quadrilateral; nSimplex = 2; break;
+      case TETRAHEDRON:   Simplex = Sampling_Tetrahedron;   nSimplex = 1; break;
+      case HEXAHEDRON:    Simplex = Sampling_Hexahedron;    nSimplex = 6; break;
+      case PRISM:         Simplex = Sampling_Prism;         nSimplex = 3; break;
+      case PYRAMID:       Simplex = Sampling_Pyramid;       nSimplex = 2; break;
+      default: continue;
+    }
+    for (iSimplex = 0; iSimplex < nSimplex; iSimplex++) {
+      for (iNode = 0; iNode <= nDim; iNode++)
+        Node[iNode] = geometry->elem[iElem]->GetNode(Simplex[iSimplex][iNode]);
+      if (SimplexWeights(geometry, val_coord, Node, Weight)) {
+        val_point.assign(Node, Node+nDim+1);
+        val_weight.assign(Weight, Weight+nDim+1);
+        return true;
+      }
+    }
+  }
+
+  return false;
+
+}
+
+void CSampling::SetSample(CSolver *solver, CConfig *config, unsigned long val_iter) {
+
+  unsigned long iLocal, iDonor, iPoint;
+  unsigned short iVar, iDim;
+  su2double Weight, Value[5];
+  bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
+  bool unsteady = (config->GetUnsteady_Simulation() != STEADY);
+
+  if (val_iter % config->GetSample_Freq() != 0) return;
+
+  /*--- Interpolate the (dimensional) primitive variables at the local samples ---*/
+
+  for (iLocal = 0; iLocal < nLocal; iLocal++) {
+    for (iVar = 0; iVar < nVar; iVar++) Value[iVar] = 0.0;
+    for (iDonor = Donor_Begin[iLocal]; iDonor < Donor_Begin[iLocal+1]; iDonor++) {
+      iPoint = Donor_Point[iDonor];
+      Weight = Donor_Weight[iDonor];
+      if (incompressible) {
+        Value[0] += Weight*solver->node[iPoint]->GetDensityInc()*config->GetDensity_Ref();
+        Value[nVar-1] += Weight*solver->node[iPoint]->GetPressureInc()*config->GetPressure_Ref();
+      }
+      else {
+        Value[0] += Weight*solver->node[iPoint]->GetDensity()*config->GetDensity_Ref();
+        Value[nVar-1] += Weight*solver->node[iPoint]->GetPressure()*config->GetPressure_Ref();
+      }
+      for (iDim = 0; iDim < nDim; iDim++)
+        Value[iDim+1] += Weight*solver->node[iPoint]->GetVelocity(iDim)*config->GetVelocity_Ref();
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer.push_back(SU2_TYPE::GetValue(Value[iVar]));
+  }
+
+  /*--- The physical time is the end of the current time step ---*/
+
+  Buffer_Iter.push_back(val_iter);
+  if (unsteady) Buffer_Time.push_back(SU2_TYPE::GetValue(su2double(val_iter+1)*config->GetDelta_UnstTime()));
+  else Buffer_Time.push_back(0.0);
+  nBuffered++;
+
+  if (nBuffered >= max((unsigned long)1, config->GetSample_Buffer())) Flush();
+
+}
+
+void CSampling::Flush(void) {
+
+  unsigned long iStep, iLocal, iSample, nBlock = nMaxLocal*nVar;
+  unsigned short iVar;
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- All the buffered time steps are gathered in a single communication ---*/
+
+  vector<passivedouble> Buffer_Send(nBuffered*nBlock+1, 0.0), Buffer_Recv;
+
+  for (iStep = 0; iStep < nBuffered; iStep++)
+    for (iLocal = 0; iLocal < nLocal*nVar; iLocal++)
+      Buffer_Send[iStep*nBlock+iLocal] = Buffer[iStep*nLocal*nVar+iLocal];
+
+  if (rank == MASTER_NODE) Buffer_Recv.resize(size*(nBuffered*nBlock+1));
+
+#ifdef HAVE_MPI
+  SU2_MPI::Gather(&Buffer_Send[0], int(nBuffered*nBlock+1), MPI_DOUBLE, rank == MASTER_NODE ? &Buffer_Recv[0] : NULL,
+                  int(nBuffered*nBlock+1), MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  Buffer_Recv = Buffer_Send;
+#endif
+
+  if (rank == MASTER_NODE) {
+
+    ofstream Sample_File(FileName.c_str(), ios::out | ios::binary | ios::app);
+    vector<passivedouble> Record(nSample*nVar, 0.0);
+    long Iter;
+
+    for (iStep = 0; iStep < nBuffered; iStep++) {
+      for (iProcessor = 0; iProcessor < size; iProcessor++)
+        for (iLocal = 0; iLocal < nMaxLocal; iLocal++) {
+          iSample = Sample_Position[iProcessor*nMaxLocal+iLocal];
+          if (iSample == nSample) continue;
+          for (iVar = 0; iVar < nVar; iVar++)
+            Record[iSample*nVar+iVar] = Buffer_Recv[iProcessor*(nBuffered*nBlock+1)+iStep*nBlock+iLocal*nVar+iVar];
+        }
+      Iter = Buffer_Iter[iStep];
+      Sample_File.write((char *)&Iter, sizeof(long));
+      Sample_File.write((char *)&Buffer_Time[iStep], sizeof(passivedouble));
+      if (nSample > 0) Sample_File.write((char *)&Record[0], nSample*nVar*sizeof(passivedouble));
+    }
+
+    Sample_File.close();
+
+  }
+
+  Buffer.clear(); Buffer_Iter.clear(); Buffer_Time.clear();
+  nBuffered = 0;
+
+}
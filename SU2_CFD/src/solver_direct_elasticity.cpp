@@ -4076,6 +4076,187 @@ void CFEM_ElasticitySolver::SetAitken_Relaxation(CGeometry **fea_geometry,
   
 }
 
+void CFEM_ElasticitySolver::SetIQN_Relaxation(CGeometry **fea_geometry, CConfig *fea_config,
+                                              CSolver ***fea_solution, unsigned long iFSIIter){
+  
+  unsigned long iPoint, iPair, jPair, kPair, nPair, nKept, iPos;
+  unsigned short iDim;
+  unsigned short nWindow = fea_config->GetIQN_WindowSize();
+  unsigned short nReuse  = fea_config->GetIQN_ReuseTimeSteps();
+  unsigned long ExtIter  = fea_config->GetExtIter();
+  su2double *dispPred, *dispCalc, *dispPred_Old, *dispCalc_Old;
+  su2double WRelax = fea_config->GetAitkenStatRelax();
+  su2double CurrentTime=fea_config->GetCurrent_DynTime();
+  su2double Static_Time=fea_config->GetStatic_Time();
+  su2double residual, pivot, update;
+  
+  /*--- Relative tolerance of the filter of the secant pairs (QR1 filter on the Cholesky pivots) ---*/
+  const su2double IQN_Filter = 1E-3;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Only when there is movement it makes sense to update the solutions... ---*/
+  
+  if (CurrentTime <= Static_Time) return;
+  
+  /*--- The pairs of the time steps older than the reuse window are dropped when a time step starts ---*/
+  
+  if (iFSIIter == 0) {
+    for (iPair = 0; iPair < IQN_TimeIter.size(); iPair++)
+      if (IQN_TimeIter[iPair] + nReuse < ExtIter) break;
+    IQN_V.resize(iPair); IQN_W.resize(iPair); IQN_TimeIter.resize(iPair);
+  }
+  
+  /*--- New secant pair from the last two sub-iterations: differences of the residuals
+   (calculated minus predicted solution) and of the calculated solutions ---*/
+  
+  else if (nWindow > 0) {
+    
+    IQN_V.insert(IQN_V.begin(), vector<su2double>(nPointDomain*nDim));
+    IQN_W.insert(IQN_W.begin(), vector<su2double>(nPointDomain*nDim));
+    IQN_TimeIter.insert(IQN_TimeIter.begin(), ExtIter);
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++){
+      dispPred     = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution_Pred();
+      dispPred_Old = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution_Pred_Old();
+      dispCalc     = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution();
+      dispCalc_Old = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution_Old();
+      for (iDim = 0; iDim < nDim; iDim++){
+        IQN_V[0][iPoint*nDim+iDim] = (dispCalc[iDim] - dispPred[iDim]) - (dispCalc_Old[iDim] - dispPred_Old[iDim]);
+        IQN_W[0][iPoint*nDim+iDim] = dispCalc[iDim] - dispCalc_Old[iDim];
+      }
+    }
+    
+    if (IQN_V.size() > nWindow) {
+      IQN_V.pop_back(); IQN_W.pop_back(); IQN_TimeIter.pop_back();
+    }
+    
+  }
+  
+  nPair = IQN_V.size();
+  
+  /*--- Normal equations of the least-squares problem min ||V c + r||: Gram matrix of the residual
+   differences and their products with the current residual, reduced in a single message ---*/
+  
+  vector<su2double> sbuf_Gram(nPair*nPair+nPair+1, 0.0), rbuf_Gram(nPair*nPair+nPair+1, 0.0);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++){
+    dispPred = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution_Pred();
+    dispCalc = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution();
+    for (iDim = 0; iDim < nDim; iDim++){
+      iPos = iPoint*nDim+iDim;
+      residual = dispCalc[iDim] - dispPred[iDim];
+      for (iPair = 0; iPair < nPair; iPair++){
+        for (jPair = 0; jPair <= iPair; jPair++)
+          sbuf_Gram[iPair*nPair+jPair] += IQN_V[iPair][iPos]*IQN_V[jPair][iPos];
+        sbuf_Gram[nPair*nPair+iPair] += IQN_V[iPair][iPos]*residual;
+      }
+    }
+  }
+  
+#ifdef HAVE_MPI
+  if (nPair > 0)
+    SU2_MPI::Allreduce(&sbuf_Gram[0], &rbuf_Gram[0], nPair*nPair+nPair, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  rbuf_Gram = sbuf_Gram;
+#endif
+  
+  /*--- Cholesky factorization (lower triangle), newest pairs first. The pairs that are almost
+   linearly dependent on the newer ones are filtered out ---*/
+  
+  vector<su2double> Chol(nPair*nPair, 0.0), Coeff(nPair, 0.0);
+  vector<unsigned long> Kept;
+  
+  for (iPair = 0; iPair < nPair; iPair++){
+    for (kPair = 0; kPair < Kept.size(); kPair++){
+      jPair = Kept[kPair];
+      Chol[iPair*nPair+jPair] = rbuf_Gram[iPair*nPair+jPair];
+      for (iPos = 0; iPos < kPair; iPos++)
+        Chol[iPair*nPair+jPair] -= Chol[iPair*nPair+Kept[iPos]]*Chol[jPair*nPair+Kept[iPos]];
+      Chol[iPair*nPair+jPair] /= Chol[jPair*nPair+jPair];
+    }
+    pivot = rbuf_Gram[iPair*nPair+iPair];
+    for (kPair = 0; kPair < Kept.size(); kPair++)
+      pivot -= pow(Chol[iPair*nPair+Kept[kPair]], 2.0);
+    if ((rbuf_Gram[iPair*nPair+iPair] > 0.0) && (pivot > IQN_Filter*IQN_Filter*rbuf_Gram[iPair*nPair+iPair])){
+      Chol[iPair*nPair+iPair] = sqrt(pivot);
+      Kept.push_back(iPair);
+    }
+  }
+  nKept = Kept.size();
+  
+  /*--- Coefficients of the pairs: L y = -V^T r, L^T c = y ---*/
+  
+  for (kPair = 0; kPair < nKept; kPair++){
+    iPair = Kept[kPair];
+    Coeff[iPair] = -rbuf_Gram[nPair*nPair+iPair];
+    for (iPos = 0; iPos < kPair; iPos++)
+      Coeff[iPair] -= Chol[iPair*nPair+Kept[iPos]]*Coeff[Kept[iPos]];
+    Coeff[iPair] /= Chol[iPair*nPair+iPair];
+  }
+  for (kPair = nKept; kPair > 0; kPair--){
+    iPair = Kept[kPair-1];
+    for (iPos = kPair; iPos < nKept; iPos++)
+      Coeff[iPair] -= Chol[Kept[iPos]*nPair+iPair]*Coeff[Kept[iPos]];
+    Coeff[iPair] /= Chol[iPair*nPair+iPair];
+  }
+  
+  /*--- Update of the predicted solution: quasi-Newton step if there are secant pairs,
+   relaxation with the static parameter otherwise ---*/
+  
+  // To nPointDomain; we need to communicate the solutions (predicted, old and old predicted) after this routine
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++){
+    
+    dispPred = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution_Pred();
+    dispCalc = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution();
+    
+    fea_solution[MESH_0][FEA_SOL]->node[iPoint]->SetSolution_Pred_Old();
+    fea_solution[MESH_0][FEA_SOL]->node[iPoint]->SetSolution_Old(dispCalc);
+    
+    for (iDim = 0; iDim < nDim; iDim++){
+      if (nKept > 0) {
+        update = dispCalc[iDim];
+        for (kPair = 0; kPair < nKept; kPair++)
+          update += Coeff[Kept[kPair]]*IQN_W[Kept[kPair]][iPoint*nDim+iDim];
+        dispPred[iDim] = update;
+      }
+      else {
+        dispPred[iDim] = (1.0 - WRelax)*dispPred[iDim] + WRelax*dispCalc[iDim];
+      }
+    }
+    
+  }
+  
+  /*--- Relaxation parameter reported in the FSI convergence summary (1 for a quasi-Newton step) ---*/
+  
+  SetWAitken_Dyn((nKept > 0)? 1.0 : WRelax);
+  
+  /*--- The filtered pairs are removed from the model ---*/
+  
+  for (iPair = nPair; iPair > 0; iPair--){
+    if (find(Kept.begin(), Kept.end(), iPair-1) != Kept.end()) continue;
+    IQN_V.erase(IQN_V.begin()+iPair-1);
+    IQN_W.erase(IQN_W.begin()+iPair-1);
+    IQN_TimeIter.erase(IQN_TimeIter.begin()+iPair-1);
+  }
+  
+  /*--- History of the FSI iterations: number of secant pairs used by the quasi-Newton step ---*/
+  
+  if (fea_config->GetWrite_Conv_FSI() && (rank == MASTER_NODE)){
+    ofstream historyFile_FSI;
+    historyFile_FSI.open (fea_config->GetConv_FileName_FSI().data(), std::ios_base::app);
+    if (iFSIIter == 0) historyFile_FSI << " " << endl ;
+    historyFile_FSI << setiosflags(ios::fixed) << setprecision(4) << CurrentTime << "," ;
+    historyFile_FSI << setiosflags(ios::fixed) << setprecision(1) << iFSIIter << "," ;
+    historyFile_FSI << nKept << "," ;
+    historyFile_FSI.close();
+  }
+  
+}
+
 void CFEM_ElasticitySolver::Update_StructSolution(CGeometry **fea_geometry,
                                                   CConfig *fea_config, CSolver ***fea_solution){
   
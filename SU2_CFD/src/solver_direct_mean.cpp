@@ -77,6 +77,7 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   LowMach_Precontioner = NULL;
   Primitive = NULL; Primitive_i = NULL; Primitive_j = NULL;
   CharacPrimVar = NULL;
+  Batch_Density = NULL; Batch_Energy = NULL; Batch_TDState = NULL; Batch_Transport = NULL;
   
   Secondary=NULL; Secondary_i=NULL; Secondary_j=NULL;
 
@@ -99,6 +100,8 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   su2double StaticEnergy, Density, Velocity2, Pressure, Temperature, dull_val;
   int Unst_RestartIter;
   ifstream restart_file;
+  stringstream restart_record;
+  istream *restart_stream = &restart_file;
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   bool restart = (config->GetRestart() || config->GetRestart_Flow());
@@ -111,6 +114,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 	bool roe_turkel = (config->GetKind_Upwind_Flow() == TURKEL);
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
   string filename = config->GetSolution_FlowFileName();
+  string history_filename;
   
   unsigned short direct_diff = config->GetDirectDiff();
   unsigned short nMarkerTurboPerf = config->Get_nMarkerTurboPerf();
@@ -165,6 +169,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   LowMach_Precontioner = NULL;
   Primitive = NULL; Primitive_i = NULL; Primitive_j = NULL;
   CharacPrimVar = NULL;
+  Batch_Density = NULL; Batch_Energy = NULL; Batch_TDState = NULL; Batch_Transport = NULL;
 
   Secondary=NULL; Secondary_i=NULL; Secondary_j=NULL;
 
@@ -261,6 +266,14 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     iPoint_UndLapl = new su2double [nPoint];
     jPoint_UndLapl = new su2double [nPoint];
   }
+
+  /*--- Define some auxiliary vectors related to the batched evaluation of the fluid model ---*/
+  
+  if (compressible) {
+    Batch_Density = new su2double [nPoint];
+    Batch_Energy  = new su2double [nPoint];
+    Batch_TDState = new su2double [nPoint*N_TDSTATE];
+  }
   
   /*--- Define some auxiliary vectors related to low-speed preconditioning ---*/
   
@@ -590,6 +603,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 
     if (nZone > 1)
 	  filename = config->GetMultizone_FileName(filename, iZone);
+    history_filename = filename;
     
     /*--- Modify file name for a dual-time unsteady restart ---*/
     
@@ -616,13 +630,19 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 		}
 		
 		
-		/*--- Open the restart file, throw an error if this fails. ---*/
+		/*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
     
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
+    if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+      CUnsteadyHistory::ReadRestart(config, history_filename, Unst_RestartIter, restart_record);
+      restart_stream = &restart_record;
+    }
+    else {
+      restart_file.open(filename.data(), ios::in);
+      if (restart_file.fail()) {
+        if (rank == MASTER_NODE)
+          cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
+        exit(EXIT_FAILURE);
+      }
     }
     
     /*--- In case this is a parallel simulation, we need to perform the
@@ -648,9 +668,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     
     /*--- The first line is the header ---*/
     
-    getline (restart_file, text_line);
+    getline (*restart_stream, text_line);
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       istringstream point_line(text_line);
       
       /*--- Retrieve local index. If this node from the restart file lives
@@ -853,6 +873,11 @@ CEulerSolver::~CEulerSolver(void) {
   if (Secondary_i != NULL)      delete [] Secondary_i;
   if (Secondary_j != NULL)      delete [] Secondary_j;
 
+  if (Batch_Density != NULL)    delete [] Batch_Density;
+  if (Batch_Energy != NULL)     delete [] Batch_Energy;
+  if (Batch_TDState != NULL)    delete [] Batch_TDState;
+  if (Batch_Transport != NULL)  delete [] Batch_Transport;
+
   if (LowMach_Precontioner != NULL) {
     for (iVar = 0; iVar < nVar; iVar ++)
       delete LowMach_Precontioner[iVar];
@@ -2118,7 +2143,8 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   Temperature_FreeStreamND = 0.0, Gas_ConstantND = 0.0,
   Velocity_FreeStreamND[3] = {0.0, 0.0, 0.0}, Viscosity_FreeStreamND = 0.0,
   Tke_FreeStreamND = 0.0, Energy_FreeStreamND = 0.0,
-  Total_UnstTimeND = 0.0, Delta_UnstTimeND = 0.0, TgammaR = 0.0;
+  Total_UnstTimeND = 0.0, Delta_UnstTimeND = 0.0, TgammaR = 0.0,
+  Pressure_MinND = 0.0, Pressure_MaxND = 0.0, Temperature_MinND = 0.0, Temperature_MaxND = 0.0;
   
   unsigned short iDim;
   
@@ -2491,6 +2517,21 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
       
   }
   
+  /*--- Replace the real gas model by look-up tables generated with it ---*/
+  
+  if (config->GetFluidModel_LUT() && ((config->GetKind_FluidModel() == VW_GAS) || (config->GetKind_FluidModel() == PR_GAS))) {
+    Pressure_MinND    = config->GetLUT_Pressure_Min()/config->GetPressure_Ref();
+    Pressure_MaxND    = config->GetLUT_Pressure_Max()/config->GetPressure_Ref();
+    Temperature_MinND = config->GetLUT_Temperature_Min()/config->GetTemperature_Ref();
+    Temperature_MaxND = config->GetLUT_Temperature_Max()/config->GetTemperature_Ref();
+    if (Pressure_MinND == 0.0)    Pressure_MinND    = 0.05*Pressure_FreeStreamND;
+    if (Pressure_MaxND == 0.0)    Pressure_MaxND    = 5.0*Pressure_FreeStreamND;
+    if (Temperature_MinND == 0.0) Temperature_MinND = 0.5*Temperature_FreeStreamND;
+    if (Temperature_MaxND == 0.0) Temperature_MaxND = 2.0*Temperature_FreeStreamND;
+    FluidModel = new CLookUpTable(FluidModel, config, Pressure_MinND, Pressure_MaxND, Temperature_MinND, Temperature_MaxND);
+    FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+  }
+  
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
   
   if (viscous) {
@@ -3261,6 +3302,18 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
   bool incompressible       = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool freesurface          = (config->GetKind_Regime() == FREESURFACE);
   
+  /*--- Compressible flow, velocity, density and internal energy of all the points,
+   and the thermodynamic state with a single call to the fluid model ---*/
+  
+  if (compressible) {
+    for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+      node[iPoint]->SetVelocity();
+      Batch_Density[iPoint] = node[iPoint]->GetDensity();
+      Batch_Energy[iPoint]  = node[iPoint]->GetEnergy() - 0.5*node[iPoint]->GetVelocity2();
+    }
+    FluidModel->SetTDState_rhoe_Batch(nPoint, Batch_Density, Batch_Energy, Batch_TDState);
+  }
+  
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Initialize the non-physical points vector ---*/
@@ -3272,8 +3325,8 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
      Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
     
     if (compressible) {
-      RightSol = node[iPoint]->SetPrimVar_Compressible(FluidModel);
-      node[iPoint]->SetSecondaryVar_Compressible(FluidModel);
+      RightSol = node[iPoint]->SetPrimVar_Compressible(&Batch_TDState[iPoint*N_TDSTATE], FluidModel);
+      node[iPoint]->SetSecondaryVar_Compressible(&Batch_TDState[iPoint*N_TDSTATE]);
     }
     
     if (incompressible) {
@@ -11558,11 +11611,13 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
   string UnstExt, text_line;
   ifstream restart_file;
+  stringstream restart_record;
+  istream *restart_stream = &restart_file;
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry[iZone]->GetnZone();
 
-  string restart_filename = config->GetSolution_FlowFileName();
+  string restart_filename = config->GetSolution_FlowFileName(), history_filename;
 
   Coord = new su2double [nDim];
   for (iDim = 0; iDim < nDim; iDim++)
@@ -11577,19 +11632,26 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
 
   if (nZone > 1)
 	restart_filename = config->GetMultizone_FileName(restart_filename, iZone);
+  history_filename = restart_filename;
 
   /*--- Modify file name for an unsteady restart ---*/
   
   if (dual_time || time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
   
-  /*--- Open the restart file, and throw an error if this fails. ---*/
+  /*--- Open the restart file (or its record in the unsteady history), and throw an error if this fails. ---*/
   
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
+  if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+    CUnsteadyHistory::ReadRestart(config, history_filename, val_iter, restart_record);
+    restart_stream = &restart_record;
+  }
+  else {
+    restart_file.open(restart_filename.data(), ios::in);
+    if (restart_file.fail()) {
+      if (rank == MASTER_NODE)
+        cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
+      exit(EXIT_FAILURE);
+    }
   }
   
   /*--- In case this is a parallel simulation, we need to perform the
@@ -11614,9 +11676,9 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   
   /*--- The first line is the header ---*/
   
-  getline (restart_file, text_line);
+  getline (*restart_stream, text_line);
   
-  while (getline (restart_file, text_line)) {
+  while (getline (*restart_stream, text_line)) {
     istringstream point_line(text_line);
     
     /*--- Retrieve local index. If this node from the restart file lives
@@ -12014,6 +12076,8 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   su2double Density, Velocity2, Pressure, Temperature, dull_val, StaticEnergy;
   int Unst_RestartIter;
   ifstream restart_file;
+  stringstream restart_record;
+  istream *restart_stream = &restart_file;
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   bool restart = (config->GetRestart() || config->GetRestart_Flow());
@@ -12026,6 +12090,7 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   bool roe_turkel = (config->GetKind_Upwind_Flow() == TURKEL);
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
   string filename = config->GetSolution_FlowFileName();
+  string history_filename;
   
   unsigned short direct_diff = config->GetDirectDiff();
   unsigned short nMarkerTurboPerf = config->Get_nMarkerTurboPerf();
@@ -12133,6 +12198,15 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     iPoint_UndLapl = new su2double [nPoint];
     jPoint_UndLapl = new su2double [nPoint];
   }
+
+  /*--- Define some auxiliary vectors related to the batched evaluation of the fluid model ---*/
+  
+  if (compressible) {
+    Batch_Density   = new su2double [nPoint];
+    Batch_Energy    = new su2double [nPoint];
+    Batch_TDState   = new su2double [nPoint*N_TDSTATE];
+    Batch_Transport = new su2double [nPoint*N_TRANSPORT];
+  }
   
   /*--- Define some auxiliary vectors related to low-speed preconditioning ---*/
   
@@ -12538,6 +12612,7 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
 
     if (nZone >1)
     	filename = config->GetMultizone_FileName(filename, iZone);
+    history_filename = filename;
     
     if (dual_time) {
       
@@ -12565,13 +12640,19 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
 			filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
 		}
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
+    /*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
     
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
+    if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+      CUnsteadyHistory::ReadRestart(config, history_filename, Unst_RestartIter, restart_record);
+      restart_stream = &restart_record;
+    }
+    else {
+      restart_file.open(filename.data(), ios::in);
+      if (restart_file.fail()) {
+        if (rank == MASTER_NODE)
+          cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
+        exit(EXIT_FAILURE);
+      }
     }
     
     /*--- In case this is a parallel simulation, we need to perform the
@@ -12597,9 +12678,9 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     
     /*--- The first line is the header ---*/
     
-    getline (restart_file, text_line);
+    getline (*restart_stream, text_line);
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       istringstream point_line(text_line);
       
       /*--- Retrieve local index. If this node from the restart file lives
@@ -12925,6 +13006,20 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
   bool incompressible       = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool freesurface          = (config->GetKind_Regime() == FREESURFACE);
   
+  /*--- Compressible flow, velocity, density and internal energy of all the points,
+   and the thermodynamic state and transport properties with a single call to the fluid model ---*/
+  
+  if (compressible) {
+    for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->node[iPoint]->GetSolution(0);
+      node[iPoint]->SetVelocity();
+      Batch_Density[iPoint] = node[iPoint]->GetDensity();
+      Batch_Energy[iPoint]  = node[iPoint]->GetEnergy() - 0.5*node[iPoint]->GetVelocity2() - turb_ke;
+    }
+    FluidModel->SetTDState_rhoe_Batch(nPoint, Batch_Density, Batch_Energy, Batch_TDState);
+    FluidModel->SetTransport_Batch(nPoint, Batch_Density, Batch_TDState, Batch_Transport);
+  }
+  
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Retrieve the value of the kinetic energy (if need it) ---*/
@@ -12943,8 +13038,9 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
      Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
     
     if (compressible) {
-      RightSol = node[iPoint]->SetPrimVar_Compressible(eddy_visc, turb_ke, FluidModel);
-      node[iPoint]->SetSecondaryVar_Compressible(FluidModel);
+      RightSol = node[iPoint]->SetPrimVar_Compressible(eddy_visc, turb_ke, &Batch_TDState[iPoint*N_TDSTATE],
+                                                       &Batch_Transport[iPoint*N_TRANSPORT], FluidModel);
+      node[iPoint]->SetSecondaryVar_Compressible(&Batch_TDState[iPoint*N_TDSTATE], &Batch_Transport[iPoint*N_TRANSPORT]);
     }
     
     if (incompressible){
@@ -993,7 +993,9 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   bool time_stepping = (config->GetUnsteady_Simulation() == TIME_STEPPING);
   string UnstExt, text_line;
   ifstream restart_file;
-  string restart_filename = config->GetSolution_FlowFileName();
+  stringstream restart_record;
+  istream *restart_stream = &restart_file;
+  string restart_filename = config->GetSolution_FlowFileName(), history_filename = restart_filename;
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -1003,12 +1005,18 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   if (dual_time|| time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
 
-  /*--- Open the restart file, throw an error if this fails. ---*/
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
+  /*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
+  if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+    CUnsteadyHistory::ReadRestart(config, history_filename, val_iter, restart_record);
+    restart_stream = &restart_record;
+  }
+  else {
+    restart_file.open(restart_filename.data(), ios::in);
+    if (restart_file.fail()) {
+      if (rank == MASTER_NODE)
+        cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
+      exit(EXIT_FAILURE);
+    }
   }
 
   /*--- In case this is a parallel simulation, we need to perform the
@@ -1045,9 +1053,9 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   }
 
   /*--- The first line is the header ---*/
-  getline (restart_file, text_line);
+  getline (*restart_stream, text_line);
 
-  while (getline (restart_file, text_line)) {
+  while (getline (*restart_stream, text_line)) {
     istringstream point_line(text_line);
 
     /*--- Retrieve local index. If this node from the restart file lives
@@ -1255,13 +1263,16 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     
     /*--- Restart the solution from file information ---*/
     ifstream restart_file;
-    string filename = config->GetSolution_FlowFileName();
+    stringstream restart_record;
+    istream *restart_stream = &restart_file;
+    string filename = config->GetSolution_FlowFileName(), history_filename;
     su2double Density, StaticEnergy, Laminar_Viscosity, nu, nu_hat, muT = 0.0, U[5];
     int Unst_RestartIter;
 
     /*--- Modify file name for multizone problems ---*/
     if (nZone >1)
       filename= config->GetMultizone_FileName(filename, iZone);
+    history_filename = filename;
     
     /*--- Modify file name for an unsteady restart ---*/
     if (dual_time) {
@@ -1285,11 +1296,17 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
+    /*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
+    if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+      CUnsteadyHistory::ReadRestart(config, history_filename, Unst_RestartIter, restart_record);
+      restart_stream = &restart_record;
+    }
+    else {
+      restart_file.open(filename.data(), ios::in);
+      if (restart_file.fail()) {
+        cout << "There is no turbulent restart file!!" << endl;
+        exit(EXIT_FAILURE);
+      }
     }
     
     /*--- In case this is a parallel simulation, we need to perform the
@@ -1309,9 +1326,9 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
     
     /*--- The first line is the header ---*/
-    getline (restart_file, text_line);
+    getline (*restart_stream, text_line);
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       istringstream point_line(text_line);
       
       /*--- Retrieve local index. If this node from the restart file lives
@@ -2637,15 +2654,18 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     
     /*--- Restart the solution from file information ---*/
     ifstream restart_file;
-    string filename = config->GetSolution_FlowFileName();
+    stringstream restart_record;
+    istream *restart_stream = &restart_file;
+    string filename = config->GetSolution_FlowFileName(), history_filename;
     
     /*--- Modify file name for multizone problems ---*/
     if (nZone >1)
       filename= config->GetMultizone_FileName(filename, iZone);
+    history_filename = filename;
 
     /*--- Modify file name for an unsteady restart ---*/
+    int Unst_RestartIter = 0;
     if (dual_time || time_stepping) {
-      int Unst_RestartIter;
       if (adjoint) {
         Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_AdjointIter()) - 1;
       } else if (config->GetUnsteady_Simulation() == DT_STEPPING_1ST)
@@ -2656,11 +2676,17 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     }
 
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
+    /*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
+    if (config->GetUnsteady_History() && (dual_time || time_stepping)) {
+      CUnsteadyHistory::ReadRestart(config, history_filename, Unst_RestartIter, restart_record);
+      restart_stream = &restart_record;
+    }
+    else {
+      restart_file.open(filename.data(), ios::in);
+      if (restart_file.fail()) {
+        cout << "There is no turbulent restart file!!" << endl;
+        exit(EXIT_FAILURE);
+      }
     }
     
     /*--- In case this is a parallel simulation, we need to perform the
@@ -2680,10 +2706,10 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
     
     /*--- The first line is the header ---*/
-    getline (restart_file, text_line);
+    getline (*restart_stream, text_line);
     
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       istringstream point_line(text_line);
       
       /*--- Retrieve local index. If this node from the restart file lives
@@ -1588,6 +1588,8 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
 	int Unst_RestartIter;
 	ifstream restart_file_n;
+	stringstream restart_record;
+	istream *restart_stream = &restart_file_n;
 	unsigned short iZone = config->GetiZone();
 	unsigned short nZone = geometry->GetnZone();
 	string filename = config->GetSolution_FlowFileName();
@@ -1621,13 +1623,19 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 	Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-1;
 	filename_n = config->GetUnsteady_FileName(filename, Unst_RestartIter);
 
-	/*--- Open the restart file, throw an error if this fails. ---*/
+	/*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
 
-	restart_file_n.open(filename_n.data(), ios::in);
-	if (restart_file_n.fail()) {
-		if (rank == MASTER_NODE)
-			cout << "There is no flow restart file!! " << filename_n.data() << "."<< endl;
-		exit(EXIT_FAILURE);
+	if (config->GetUnsteady_History()) {
+		CUnsteadyHistory::ReadRestart(config, filename, Unst_RestartIter, restart_record);
+		restart_stream = &restart_record;
+	}
+	else {
+		restart_file_n.open(filename_n.data(), ios::in);
+		if (restart_file_n.fail()) {
+			if (rank == MASTER_NODE)
+				cout << "There is no flow restart file!! " << filename_n.data() << "."<< endl;
+			exit(EXIT_FAILURE);
+		}
 	}
 
 	/*--- In case this is a parallel simulation, we need to perform the
@@ -1649,9 +1657,9 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 	/*--- Read all lines in the restart file ---*/
 	/*--- The first line is the header ---*/
 
-	getline (restart_file_n, text_line);
+	getline (*restart_stream, text_line);
 
-	while (getline (restart_file_n, text_line)) {
+	while (getline (*restart_stream, text_line)) {
 		istringstream point_line(text_line);
 
 		/*--- Retrieve local index. If this node from the restart file lives
@@ -1725,13 +1733,19 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 		Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-2;
 		filename_n1 = config->GetUnsteady_FileName(filename, Unst_RestartIter);
 
-		/*--- Open the restart file, throw an error if this fails. ---*/
+		/*--- Open the restart file (or its record in the unsteady history), throw an error if this fails. ---*/
 
-		restart_file_n.open(filename_n1.data(), ios::in);
-		if (restart_file_n.fail()) {
-			if (rank == MASTER_NODE)
-				cout << "There is no flow restart file!! " << filename_n1.data() << "."<< endl;
-			exit(EXIT_FAILURE);
+		if (config->GetUnsteady_History()) {
+			CUnsteadyHistory::ReadRestart(config, filename, Unst_RestartIter, restart_record);
+			restart_stream = &restart_record;
+		}
+		else {
+			restart_file_n.open(filename_n1.data(), ios::in);
+			if (restart_file_n.fail()) {
+				if (rank == MASTER_NODE)
+					cout << "There is no flow restart file!! " << filename_n1.data() << "."<< endl;
+				exit(EXIT_FAILURE);
+			}
 		}
 
 		/*--- In case this is a parallel simulation, we need to perform the
@@ -1753,9 +1767,9 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 		/*--- Read all lines in the restart file ---*/
 		/*--- The first line is the header ---*/
 
-		getline (restart_file_n, text_line);
+		getline (*restart_stream, text_line);
 
-		while (getline (restart_file_n, text_line)) {
+		while (getline (*restart_stream, text_line)) {
 			istringstream point_line(text_line);
 
 			/*--- Retrieve local index. If this node from the restart file lives
@@ -1869,6 +1883,9 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   string Tag, text_line, AdjExt, UnstExt;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
+  bool adjoint = (config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint());
+  bool history = (config->GetUnsteady_History() && config->GetWrt_Unsteady() &&
+                  (config->GetUnsteady_Simulation() != TIME_SPECTRAL) && !adjoint && !fem);
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
@@ -1885,7 +1902,9 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   /*--- Restart the solution from file information ---*/
   
   ifstream restart_file;
-  string filename;
+  stringstream restart_record;
+  istream *restart_stream = &restart_file;
+  string filename, history_filename;
   
   /*--- Retrieve filename from config ---*/
   
@@ -1902,6 +1921,7 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
 
   if (nZone > 1)
 	filename = config->GetMultizone_FileName(filename, iZone);
+  history_filename = filename;
 
   /*--- Unsteady problems require an iteration number to be appended. ---*/
 
@@ -1911,13 +1931,17 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
 	filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
   
-  /*--- Open the restart file ---*/
+  /*--- Open the restart file (or its record in the unsteady history) ---*/
   
-  restart_file.open(filename.data(), ios::in);
+  if (history) {
+    CUnsteadyHistory::ReadRestart(config, history_filename, long(iExtIter), restart_record);
+    restart_stream = &restart_record;
+  }
+  else restart_file.open(filename.data(), ios::in);
   
   /*--- In case there is no restart file ---*/
   
-  if (restart_file.fail()) {
+  if (!history && restart_file.fail()) {
     if (rank == MASTER_NODE)
       cout << "SU2 flow file " << filename << " not found" << endl;
 
@@ -1953,7 +1977,7 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   
   /*--- Identify the number of fields (and names) in the restart file ---*/
   
-  getline (restart_file, text_line);
+  getline (*restart_stream, text_line);
   stringstream ss(text_line);
   while (ss >> Tag) {
     config->fields.push_back(Tag);
@@ -1969,7 +1993,7 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   /*--- Read all lines in the restart file ---*/
   
   iPoint_Global = 0;
-  while (getline (restart_file, text_line)) {
+  while (getline (*restart_stream, text_line)) {
     istringstream point_line(text_line);
     
     /*--- Retrieve local index. If this node from the restart file lives
@@ -2215,14 +2239,18 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 #endif
   
   /*--- Restart the solution from file information ---*/
-  string filename;
+  string filename, history_filename;
   unsigned long iPoint, index;
   string UnstExt, text_line, AdjExt;
   ifstream solution_file;
+  stringstream solution_record;
+  istream *solution_stream = &solution_file;
   unsigned short iField;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   bool adjoint = ( config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint() ); 
+  bool history = (config->GetUnsteady_History() && config->GetWrt_Unsteady() &&
+                  (config->GetUnsteady_Simulation() != TIME_SPECTRAL) && !adjoint && !fem);
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry[iZone]->GetnZone();
 
@@ -2240,6 +2268,7 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 
   if (nZone > 1)
 	filename = config->GetMultizone_FileName(filename, iZone);
+  history_filename = filename;
 
   /*--- Unsteady problems require an iteration number to be appended. ---*/
   if (config->GetWrt_Unsteady() || config->GetUnsteady_Simulation() == TIME_SPECTRAL) {
@@ -2248,14 +2277,20 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 	filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
 
-  /*--- Open the restart file ---*/
-  solution_file.open(filename.data(), ios::in);
-  
-  /*--- In case there is no file ---*/
-  if (solution_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no SU2 restart file!!" << endl;
-    exit(EXIT_FAILURE);
+  /*--- Open the restart file (or its record in the unsteady history) ---*/
+  if (history) {
+    CUnsteadyHistory::ReadRestart(config, history_filename, long(iExtIter), solution_record);
+    solution_stream = &solution_record;
+  }
+  else {
+    solution_file.open(filename.data(), ios::in);
+    
+    /*--- In case there is no file ---*/
+    if (solution_file.fail()) {
+      if (rank == MASTER_NODE)
+        cout << "There is no SU2 restart file!!" << endl;
+      exit(EXIT_FAILURE);
+    }
   }
   
   /*--- Output the file name to the console. ---*/
@@ -2286,9 +2321,9 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   long iPoint_Local = 0; unsigned long iPoint_Global = 0;
   
   /*--- The first line is the header ---*/
-  getline (solution_file, text_line);
+  getline (*solution_stream, text_line);
   
-  while (getline (solution_file, text_line)) {
+  while (getline (*solution_stream, text_line)) {
     istringstream point_line(text_line);
     
     /*--- Retrieve local index. If this node from the restart file lives
@@ -1270,3 +1270,294 @@ void CTransfer::Allgather_InterfaceData(CSolver *donor_solution, CSolver *target
   
   
 }
+
+void CTransfer::Sparse_InterfaceData(CSolver *donor_solution, CSolver *target_solution,
+                                     CGeometry *donor_geometry, CGeometry *target_geometry,
+                                     CConfig *donor_config, CConfig *target_config){
+  
+  unsigned short nMarkerInt, nMarkerDonor, nMarkerTarget;		// Number of markers on the interface, donor and target side
+  unsigned short iMarkerInt, iMarkerDonor, iMarkerTarget;		// Variables for iteration over markers
+  int Marker_Donor = -1, Marker_Target = -1;
+  
+  unsigned long iVertex, iDonor, iSend, iRecv, nRecv, Point_Donor, Point_Target;
+  unsigned short iVar;
+  int iProc, jProc;
+  
+  int rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
+                        donor_config, target_config);
+  
+  /*--- Number of markers on the FSI interface ---*/
+  
+  nMarkerInt     = (donor_config->GetMarker_n_FSIinterface())/2;
+  nMarkerTarget  = target_geometry->GetnMarker();
+  nMarkerDonor   = donor_geometry->GetnMarker();
+  
+  /*--- The operators are built the first time the data is transferred, after the interpolation ---*/
+  
+  if (Sparse_Operator.size() != nMarkerInt) {
+    
+    Sparse_Operator.resize(nMarkerInt);
+    
+    for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++){
+      
+      Marker_Donor = -1;
+      Marker_Target = -1;
+      
+      for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
+        if ( donor_config->GetMarker_All_FSIinterface(iMarkerDonor) == iMarkerInt ){
+          Marker_Donor = iMarkerDonor;
+          break;
+        }
+      }
+      
+      for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
+        if ( target_config->GetMarker_All_FSIinterface(iMarkerTarget) == iMarkerInt ){
+          Marker_Target = iMarkerTarget;
+          break;
+        }
+      }
+      
+      Sparse_Operator[iMarkerInt-1].SetOperator(donor_geometry, target_geometry, Marker_Donor, Marker_Target);
+      
+    }
+    
+  }
+  
+  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++){
+    
+    CTransferOperator &Operator = Sparse_Operator[iMarkerInt-1];
+    
+    Marker_Donor  = Operator.Marker_Donor;
+    Marker_Target = Operator.Marker_Target;
+    
+    /*--- Donor variables of the vertices needed by any processor, each of them computed once ---*/
+    
+    vector<su2double> Donor_Values(Operator.Donor_Vertex.size()*nVar+1);
+    
+    for (iVertex = 0; iVertex < Operator.Donor_Vertex.size(); iVertex++){
+      Point_Donor = donor_geometry->vertex[Marker_Donor][Operator.Donor_Vertex[iVertex]]->GetNode();
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, Operator.Donor_Vertex[iVertex], Point_Donor);
+      for (iVar = 0; iVar < nVar; iVar++)
+        Donor_Values[iVertex*nVar+iVar] = Donor_Variable[iVar];
+    }
+    
+    vector<su2double> Buffer_Send(Operator.Send_Slot.size()*nVar+1);
+    for (iSend = 0; iSend < Operator.Send_Slot.size(); iSend++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        Buffer_Send[iSend*nVar+iVar] = Donor_Values[Operator.Send_Slot[iSend]*nVar+iVar];
+    
+    nRecv = Operator.Recv_Index.back();
+    vector<su2double> Buffer_Recv(nRecv*nVar+1);
+    
+    /*--- Exchange the donor values with the neighbours of the operator; the local values are copied ---*/
+    
+#ifdef HAVE_MPI
+    vector<MPI_Request> Request;
+    MPI_Request request;
+    for (iProc = 0; iProc < (int)Operator.Recv_Proc.size(); iProc++){
+      if (Operator.Recv_Proc[iProc] == rank) continue;
+      SU2_MPI::Irecv(&Buffer_Recv[Operator.Recv_Index[iProc]*nVar], (Operator.Recv_Index[iProc+1]-Operator.Recv_Index[iProc])*nVar,
+                     MPI_DOUBLE, Operator.Recv_Proc[iProc], 0, MPI_COMM_WORLD, &request);
+      Request.push_back(request);
+    }
+    for (iProc = 0; iProc < (int)Operator.Send_Proc.size(); iProc++){
+      if (Operator.Send_Proc[iProc] == rank) continue;
+      SU2_MPI::Isend(&Buffer_Send[Operator.Send_Index[iProc]*nVar], (Operator.Send_Index[iProc+1]-Operator.Send_Index[iProc])*nVar,
+                     MPI_DOUBLE, Operator.Send_Proc[iProc], 0, MPI_COMM_WORLD, &request);
+      Request.push_back(request);
+    }
+#endif
+    
+    for (iProc = 0; iProc < (int)Operator.Send_Proc.size(); iProc++){
+      if (Operator.Send_Proc[iProc] != rank) continue;
+      for (jProc = 0; jProc < (int)Operator.Recv_Proc.size(); jProc++){
+        if (Operator.Recv_Proc[jProc] != rank) continue;
+        for (iSend = Operator.Send_Index[iProc]*nVar; iSend < Operator.Send_Index[iProc+1]*nVar; iSend++)
+          Buffer_Recv[Operator.Recv_Index[jProc]*nVar+iSend-Operator.Send_Index[iProc]*nVar] = Buffer_Send[iSend];
+      }
+    }
+    
+#ifdef HAVE_MPI
+    if (!Request.empty())
+      SU2_MPI::Waitall(Request.size(), &Request[0], MPI_STATUSES_IGNORE);
+#endif
+    
+    /*--- Apply the coefficients and set the variables on the target vertices ---*/
+    
+    for (iVertex = 0; iVertex < Operator.Target_Vertex.size(); iVertex++){
+      
+      Point_Target = target_geometry->vertex[Marker_Target][Operator.Target_Vertex[iVertex]]->GetNode();
+      
+      for (iVar = 0; iVar < nVar; iVar++) Target_Variable[iVar] = 0.0;
+      
+      for (iDonor = Operator.Target_Index[iVertex]; iDonor < Operator.Target_Index[iVertex+1]; iDonor++){
+        iRecv = Operator.Target_Slot[iDonor];
+        for (iVar = 0; iVar < nVar; iVar++)
+          Target_Variable[iVar] += Operator.Target_Coeff[iDonor] * Buffer_Recv[iRecv*nVar+iVar];
+      }
+      
+      SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, Operator.Target_Vertex[iVertex], Point_Target);
+      
+    }
+    
+  }
+  
+}
+
+CTransferOperator::CTransferOperator(void) {
+  
+  Marker_Donor  = -1;
+  Marker_Target = -1;
+  
+  Send_Index.assign(1, 0);
+  Recv_Index.assign(1, 0);
+  Target_Index.assign(1, 0);
+  
+}
+
+CTransferOperator::~CTransferOperator(void) { }
+
+void CTransferOperator::SetOperator(CGeometry *donor_geometry, CGeometry *target_geometry,
+                                    int val_marker_donor, int val_marker_target){
+  
+  unsigned long iVertex, iPoint, iRequest, nRequest, Global_Index;
+  unsigned short iDonor, nDonor;
+  int iProc, nProc, Donor_Proc;
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  Marker_Donor  = val_marker_donor;
+  Marker_Target = val_marker_target;
+  
+  Donor_Vertex.clear(); Send_Proc.clear(); Send_Index.assign(1, 0); Send_Slot.clear();
+  Recv_Proc.clear(); Recv_Index.assign(1, 0);
+  Target_Vertex.clear(); Target_Index.assign(1, 0); Target_Slot.clear(); Target_Coeff.clear();
+  
+  /*--- Donor points needed by the local target vertices, grouped by owner ---*/
+  
+  vector<vector<unsigned long> > Request(size);
+  
+  if (Marker_Target >= 0) {
+    for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++){
+      iPoint = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+      nDonor = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
+      for (iDonor = 0; iDonor < nDonor; iDonor++)
+        Request[target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorProcessor(iDonor)].push_back(
+            target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonor));
+    }
+  }
+  
+  vector<int> Recv_Count(size), Send_Count(size);
+  vector<unsigned long> Recv_Offset(size+1, 0);
+  for (iProc = 0; iProc < size; iProc++){
+    sort(Request[iProc].begin(), Request[iProc].end());
+    Request[iProc].erase(unique(Request[iProc].begin(), Request[iProc].end()), Request[iProc].end());
+    Recv_Count[iProc] = Request[iProc].size();
+    Recv_Offset[iProc+1] = Recv_Offset[iProc]+Recv_Count[iProc];
+    if (Recv_Count[iProc] > 0){
+      Recv_Proc.push_back(iProc);
+      Recv_Index.push_back(Recv_Offset[iProc+1]);
+    }
+  }
+  
+  /*--- Coefficients of the target vertices, with the position of the donor values in the receive buffer ---*/
+  
+  if (Marker_Target >= 0) {
+    for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++){
+      iPoint = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+      nDonor = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
+      for (iDonor = 0; iDonor < nDonor; iDonor++){
+        Donor_Proc   = target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorProcessor(iDonor);
+        Global_Index = target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonor);
+        Target_Slot.push_back(Recv_Offset[Donor_Proc] + (lower_bound(Request[Donor_Proc].begin(), Request[Donor_Proc].end(), Global_Index)-Request[Donor_Proc].begin()));
+        Target_Coeff.push_back(target_geometry->vertex[Marker_Target][iVertex]->GetDonorCoeff(iDonor));
+      }
+      Target_Vertex.push_back(iVertex);
+      Target_Index.push_back(Target_Slot.size());
+    }
+  }
+  
+  /*--- Send the requests to the owners of the donor points ---*/
+  
+#ifdef HAVE_MPI
+  MPI_Alltoall(&Recv_Count[0], 1, MPI_INT, &Send_Count[0], 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  Send_Count[0] = Recv_Count[0];
+#endif
+  
+  vector<unsigned long> Send_Offset(size+1, 0);
+  for (iProc = 0; iProc < size; iProc++){
+    Send_Offset[iProc+1] = Send_Offset[iProc]+Send_Count[iProc];
+    if (Send_Count[iProc] > 0){
+      Send_Proc.push_back(iProc);
+      Send_Index.push_back(Send_Offset[iProc+1]);
+    }
+  }
+  
+  nRequest = Send_Offset[size];
+  vector<unsigned long> Buffer_Request(nRequest+1);
+  
+#ifdef HAVE_MPI
+  vector<MPI_Request> Comm_Request;
+  MPI_Request request;
+  for (nProc = 0; nProc < (int)Send_Proc.size(); nProc++){
+    iProc = Send_Proc[nProc];
+    if (iProc == rank) continue;
+    SU2_MPI::Irecv(&Buffer_Request[Send_Offset[iProc]], Send_Count[iProc], MPI_UNSIGNED_LONG, iProc, 0, MPI_COMM_WORLD, &request);
+    Comm_Request.push_back(request);
+  }
+  for (nProc = 0; nProc < (int)Recv_Proc.size(); nProc++){
+    iProc = Recv_Proc[nProc];
+    if (iProc == rank) continue;
+    SU2_MPI::Isend(&Request[iProc][0], Recv_Count[iProc], MPI_UNSIGNED_LONG, iProc, 0, MPI_COMM_WORLD, &request);
+    Comm_Request.push_back(request);
+  }
+  if (!Comm_Request.empty())
+    SU2_MPI::Waitall(Comm_Request.size(), &Comm_Request[0], MPI_STATUSES_IGNORE);
+#endif
+  
+  for (iRequest = 0; iRequest < Request[rank].size(); iRequest++)
+    Buffer_Request[Send_Offset[rank]+iRequest] = Request[rank][iRequest];
+  
+  /*--- Local donor vertices of the requested points, each of them computed once ---*/
+  
+  map<unsigned long, unsigned long> Donor_Global;
+  map<unsigned long, unsigned long>::iterator it;
+  
+  if (Marker_Donor >= 0) {
+    for (iVertex = 0; iVertex < donor_geometry->GetnVertex(Marker_Donor); iVertex++){
+      iPoint = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+      if (donor_geometry->node[iPoint]->GetDomain())
+        Donor_Global[donor_geometry->node[iPoint]->GetGlobalIndex()] = iVertex;
+    }
+  }
+  
+  map<unsigned long, unsigned long> Donor_Slot;
+  for (iRequest = 0; iRequest < nRequest; iRequest++){
+    it = Donor_Global.find(Buffer_Request[iRequest]);
+    if (it == Donor_Global.end()) {
+      cout << "ERROR: Donor point " << Buffer_Request[iRequest] << " of the interface is not in processor " << rank << "." << endl;
+      exit(EXIT_FAILURE);
+    }
+    if (Donor_Slot.find(it->second) == Donor_Slot.end()) {
+      Donor_Slot[it->second] = Donor_Vertex.size();
+      Donor_Vertex.push_back(it->second);
+    }
+    Send_Slot.push_back(Donor_Slot[it->second]);
+  }
+  
+}
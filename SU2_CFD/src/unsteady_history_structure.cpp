@@ -0,0 +1,401 @@
+/*!
+ * \file unsteady_history_structure.cpp
+ * \brief Main subroutines of the container for the unsteady solution history.
+ * \author F. Palacios, T. Economon
+ * \version 4.2.0 "Cardinal"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *
+ * Copyright (C) 2012-2016 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/unsteady_history_structure.hpp"
+
+#include <cstring>
+#include <iomanip>
+#include <unistd.h>
+
+#ifdef HAVE_ZLIB
+#include "zlib.h"
+#endif
+
+/*--- Layout of the file: file tag, records, index, index tail. Each record
+ starts with a tag and a fixed header, followed by the header line of the
+ restart file and the (compressed) values, variable by variable. ---*/
+
+static const char History_FileTag[8]  = {'S','U','2','H','I','S','T','1'};
+static const char History_IndexTag[8] = {'S','U','2','H','I','D','X','1'};
+static const char History_RecordTag[4] = {'S','U','2','R'};
+
+/*--- Flags of the records ---*/
+
+static const unsigned long HISTORY_SHUFFLED = 1;
+static const unsigned long HISTORY_ZLIB     = 2;
+
+/*!
+ * \brief Fixed part of the header of a record.
+ */
+struct CHistoryRecordHeader {
+  char Tag[4];                /*!< \brief Record tag. */
+  unsigned int nDim;          /*!< \brief Number of coordinates. */
+  long Iter;                  /*!< \brief Time step. */
+  unsigned long nPoint,       /*!< \brief Number of points. */
+  nVar,                       /*!< \brief Number of values per point (coordinates included). */
+  Flags,                      /*!< \brief Shuffle and compression flags. */
+  Header_Size,                /*!< \brief Size of the header line of the restart file. */
+  Data_Size;                  /*!< \brief Size of the stored values. */
+};
+
+CUnsteadyHistory::CUnsteadyHistory(CConfig *config, string val_filename, long val_iter) {
+
+  unsigned long History_Steps = config->GetHistory_Steps();
+  string::size_type position;
+  ostringstream name;
+
+  /*--- restart_flow.dat is stored in restart_flow_history.bin, or in
+   restart_flow_history_00002.bin when the history is split in blocks ---*/
+
+  position = val_filename.find_last_of(".");
+  if ((position != string::npos) && (val_filename.find_last_of("/") == string::npos ||
+                                     position > val_filename.find_last_of("/")))
+    val_filename = val_filename.substr(0, position);
+
+  name << val_filename << "_history";
+  if (History_Steps > 0)
+    name << "_" << setfill('0') << setw(5) << (val_iter / long(History_Steps));
+  name << ".bin";
+  FileName = name.str();
+
+  /*--- Mantissa bits that keep the relative error below the tolerance ---*/
+
+  Kind_Compression = config->GetKind_History_Compression();
+  nMantissa_Bits = 52;
+  if (Kind_Compression == HISTORY_LOSSY) {
+    passivedouble Tolerance = SU2_TYPE::GetValue(config->GetHistory_Tolerance());
+    if (Tolerance > 0.0)
+      nMantissa_Bits = (unsigned short)max(1.0, min(52.0, ceil(-log(Tolerance)/log(2.0))));
+  }
+
+  Index_Position = sizeof(History_FileTag);
+  ReadIndex();
+
+}
+
+CUnsteadyHistory::~CUnsteadyHistory(void) { }
+
+string CUnsteadyHistory::GetFileName(void) { return FileName; }
+
+bool CUnsteadyHistory::ReadIndex(void) {
+
+  ifstream history_file;
+  char Tag[8];
+  unsigned long iRecord, nRecord, Position, FileSize, Offset;
+  long Iter;
+  CHistoryRecordHeader Record;
+
+  Index.clear();
+  Index_Position = sizeof(History_FileTag);
+
+  history_file.open(FileName.c_str(), ios::in | ios::binary);
+  if (history_file.fail()) return false;
+
+  history_file.seekg(0, ios::end);
+  FileSize = (unsigned long)history_file.tellg();
+  history_file.seekg(0, ios::beg);
+  history_file.read(Tag, sizeof(Tag));
+  if (history_file.fail() || (memcmp(Tag, History_FileTag, sizeof(Tag)) != 0)) {
+    cout << "WARNING: " << FileName << " is not an unsteady history file." << endl;
+    return false;
+  }
+
+  /*--- The tail of the file gives the position and size of the index ---*/
+
+  if (FileSize >= sizeof(History_FileTag) + 2*sizeof(unsigned long) + sizeof(Tag)) {
+    history_file.seekg(FileSize - 2*sizeof(unsigned long) - sizeof(Tag), ios::beg);
+    history_file.read((char *)&nRecord, sizeof(unsigned long));
+    history_file.read((char *)&Position, sizeof(unsigned long));
+    history_file.read(Tag, sizeof(Tag));
+    if (!history_file.fail() && (memcmp(Tag, History_IndexTag, sizeof(Tag)) == 0) &&
+        (Position + nRecord*(sizeof(long) + sizeof(unsigned long)) + 2*sizeof(unsigned long) + sizeof(Tag) == FileSize)) {
+      history_file.seekg(Position, ios::beg);
+      for (iRecord = 0; iRecord < nRecord; iRecord++) {
+        history_file.read((char *)&Iter, sizeof(long));
+        history_file.read((char *)&Offset, sizeof(unsigned long));
+        Index[Iter] = Offset;
+      }
+      if (!history_file.fail()) {
+        Index_Position = Position;
+        return true;
+      }
+      Index.clear();
+    }
+  }
+
+  /*--- The index is damaged (the simulation stopped while writing a record),
+   rebuild it from the complete records ---*/
+
+  cout << "WARNING: Rebuilding the index of " << FileName << "." << endl;
+  history_file.clear();
+  Position = sizeof(History_FileTag);
+  while (Position + sizeof(CHistoryRecordHeader) <= FileSize) {
+    history_file.seekg(Position, ios::beg);
+    history_file.read((char *)&Record, sizeof(CHistoryRecordHeader));
+    if (history_file.fail() || (memcmp(Record.Tag, History_RecordTag, sizeof(Record.Tag)) != 0)) break;
+    Offset = Position + sizeof(CHistoryRecordHeader) + Record.Header_Size + Record.Data_Size;
+    if (Offset > FileSize) break;
+    Index[Record.Iter] = Position;
+    Position = Offset;
+  }
+  Index_Position = Position;
+
+  return true;
+
+}
+
+bool CUnsteadyHistory::WriteRecord(long val_iter, string val_header, su2double **val_coord, unsigned short val_nDim,
+                                   su2double **val_data, unsigned short val_nVar, unsigned long val_nPoint) {
+
+  unsigned long iPoint, iVar, iByte, nValue, nByte, Position, nRecord;
+  unsigned long nVar = val_nDim + val_nVar;
+  unsigned short iDim;
+  unsigned long long Mask, Half, Bits;
+  fstream history_file;
+  CHistoryRecordHeader Record;
+  map<long, unsigned long>::iterator it;
+
+  /*--- Values variable by variable (coordinates first), which groups
+   similar numbers for the compression ---*/
+
+  nValue = nVar*val_nPoint;
+  nByte  = nValue*sizeof(passivedouble);
+  passivedouble *Values = new passivedouble[nValue];
+  for (iDim = 0; iDim < val_nDim; iDim++)
+    for (iPoint = 0; iPoint < val_nPoint; iPoint++)
+      Values[iDim*val_nPoint+iPoint] = SU2_TYPE::GetValue(val_coord[iDim][iPoint]);
+  for (iVar = 0; iVar < val_nVar; iVar++)
+    for (iPoint = 0; iPoint < val_nPoint; iPoint++)
+      Values[(val_nDim+iVar)*val_nPoint+iPoint] = SU2_TYPE::GetValue(val_data[iVar][iPoint]);
+
+  /*--- Lossy compression: round the mantissa of the solution (not the
+   coordinates) to the bits that satisfy the relative tolerance, the zeroed
+   low order bytes are then removed by the compressor ---*/
+
+  if ((Kind_Compression == HISTORY_LOSSY) && (nMantissa_Bits < 52)) {
+    Half = 1ULL << (51 - nMantissa_Bits);
+    Mask = ~((Half << 1) - 1ULL);
+    for (iPoint = val_nDim*val_nPoint; iPoint < nValue; iPoint++) {
+      memcpy(&Bits, &Values[iPoint], sizeof(passivedouble));
+      if (((Bits >> 52) & 0x7FFULL) != 0x7FFULL) Bits = (Bits + Half) & Mask;
+      memcpy(&Values[iPoint], &Bits, sizeof(passivedouble));
+    }
+  }
+
+  char *Data = (char *)Values;
+  char *Buffer = NULL;
+
+  Record.Flags = 0;
+  Record.Data_Size = nByte;
+
+  if (Kind_Compression != HISTORY_NONE) {
+
+    /*--- Byte shuffle: first byte of all the values, then the second, ... ---*/
+
+    Buffer = new char[nByte];
+    for (iPoint = 0; iPoint < nValue; iPoint++)
+      for (iByte = 0; iByte < sizeof(passivedouble); iByte++)
+        Buffer[iByte*nValue+iPoint] = Data[iPoint*sizeof(passivedouble)+iByte];
+    Data = Buffer;
+    Record.Flags |= HISTORY_SHUFFLED;
+
+#ifdef HAVE_ZLIB
+    uLongf CompressedSize = compressBound(nByte);
+    char *Compressed = new char[CompressedSize];
+    if (compress2((Bytef *)Compressed, &CompressedSize, (const Bytef *)Buffer, nByte, Z_BEST_SPEED) == Z_OK) {
+      delete [] Buffer;
+      Buffer = Compressed;
+      Data = Buffer;
+      Record.Data_Size = CompressedSize;
+      Record.Flags |= HISTORY_ZLIB;
+    }
+    else delete [] Compressed;
+#endif
+
+  }
+
+  /*--- Open (or create) the container and write the new record in place of the index ---*/
+
+  history_file.open(FileName.c_str(), ios::in | ios::out | ios::binary);
+  if (history_file.fail()) {
+    history_file.clear();
+    history_file.open(FileName.c_str(), ios::out | ios::binary);
+    Index.clear();
+    Index_Position = sizeof(History_FileTag);
+  }
+  if (history_file.fail()) {
+    cout << "WARNING: Unable to open the unsteady history file " << FileName << "." << endl;
+    delete [] Values; if (Buffer != NULL) delete [] Buffer;
+    return false;
+  }
+
+  history_file.seekp(0, ios::beg);
+  history_file.write(History_FileTag, sizeof(History_FileTag));
+
+  memcpy(Record.Tag, History_RecordTag, sizeof(Record.Tag));
+  Record.nDim        = val_nDim;
+  Record.Iter        = val_iter;
+  Record.nPoint      = val_nPoint;
+  Record.nVar        = nVar;
+  Record.Header_Size = val_header.size();
+
+  Position = Index_Position;
+  history_file.seekp(Position, ios::beg);
+  history_file.write((char *)&Record, sizeof(CHistoryRecordHeader));
+  history_file.write(val_header.c_str(), Record.Header_Size);
+  history_file.write(Data, Record.Data_Size);
+
+  /*--- A time step that is written again replaces the old record in the index ---*/
+
+  Index[val_iter] = Position;
+  Index_Position = Position + sizeof(CHistoryRecordHeader) + Record.Header_Size + Record.Data_Size;
+
+  nRecord = Index.size();
+  for (it = Index.begin(); it != Index.end(); it++) {
+    history_file.write((char *)&(it->first), sizeof(long));
+    history_file.write((char *)&(it->second), sizeof(unsigned long));
+  }
+  history_file.write((char *)&nRecord, sizeof(unsigned long));
+  history_file.write((char *)&Index_Position, sizeof(unsigned long));
+  history_file.write(History_IndexTag, sizeof(History_IndexTag));
+
+  Position = (unsigned long)history_file.tellp();
+  history_file.close();
+
+  /*--- Remove what is left of a damaged file after the new index ---*/
+
+  if (truncate(FileName.c_str(), Position) != 0)
+    cout << "WARNING: Unable to truncate the unsteady history file " << FileName << "." << endl;
+
+  delete [] Values;
+  if (Buffer != NULL) delete [] Buffer;
+
+  if (history_file.fail()) {
+    cout << "WARNING: Unable to write the unsteady history file " << FileName << "." << endl;
+    return false;
+  }
+
+  return true;
+
+}
+
+bool CUnsteadyHistory::ReadRecord(long val_iter, stringstream &val_record) {
+
+  unsigned long iPoint, iVar, iByte, nValue, nByte;
+  ifstream history_file;
+  CHistoryRecordHeader Record;
+  map<long, unsigned long>::iterator it = Index.find(val_iter);
+
+  if (it == Index.end()) return false;
+
+  history_file.open(FileName.c_str(), ios::in | ios::binary);
+  if (history_file.fail()) return false;
+
+  history_file.seekg(it->second, ios::beg);
+  history_file.read((char *)&Record, sizeof(CHistoryRecordHeader));
+  if (history_file.fail() || (memcmp(Record.Tag, History_RecordTag, sizeof(Record.Tag)) != 0)) return false;
+
+  string Header(Record.Header_Size, ' ');
+  if (Record.Header_Size > 0) history_file.read(&Header[0], Record.Header_Size);
+
+  nValue = Record.nVar*Record.nPoint;
+  nByte  = nValue*sizeof(passivedouble);
+  char *Buffer = new char[Record.Data_Size];
+  history_file.read(Buffer, Record.Data_Size);
+  history_file.close();
+  if (history_file.fail()) { delete [] Buffer; return false; }
+
+  /*--- Undo the compression and the byte shuffle ---*/
+
+  if (Record.Flags & HISTORY_ZLIB) {
+#ifdef HAVE_ZLIB
+    uLongf UncompressedSize = nByte;
+    char *Uncompressed = new char[nByte];
+    if ((uncompress((Bytef *)Uncompressed, &UncompressedSize, (const Bytef *)Buffer, Record.Data_Size) != Z_OK) ||
+        (UncompressedSize != nByte)) {
+      cout << "WARNING: Damaged record " << val_iter << " in " << FileName << "." << endl;
+      delete [] Uncompressed; delete [] Buffer;
+      return false;
+    }
+    delete [] Buffer;
+    Buffer = Uncompressed;
+#else
+    cout << "The unsteady history " << FileName << " is compressed but SU2 was built without zlib support." << endl;
+    delete [] Buffer;
+    return false;
+#endif
+  }
+
+  passivedouble *Values = new passivedouble[nValue];
+  char *Data = (char *)Values;
+  if (Record.Flags & HISTORY_SHUFFLED) {
+    for (iPoint = 0; iPoint < nValue; iPoint++)
+      for (iByte = 0; iByte < sizeof(passivedouble); iByte++)
+        Data[iPoint*sizeof(passivedouble)+iByte] = Buffer[iByte*nValue+iPoint];
+  }
+  else memcpy(Data, Buffer, nByte);
+  delete [] Buffer;
+
+  /*--- Text of the equivalent restart file, with all the digits of the values ---*/
+
+  val_record.str("");
+  val_record.clear();
+  val_record.precision(17);
+  val_record << Header << "\n";
+  for (iPoint = 0; iPoint < Record.nPoint; iPoint++) {
+    val_record << iPoint << "\t";
+    for (iVar = 0; iVar < Record.nVar; iVar++)
+      val_record << scientific << Values[iVar*Record.nPoint+iPoint] << "\t";
+    val_record << "\n";
+  }
+
+  delete [] Values;
+
+  return true;
+
+}
+
+void CUnsteadyHistory::ReadRestart(CConfig *config, string val_filename, long val_iter, stringstream &val_record) {
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  CUnsteadyHistory history(config, val_filename, val_iter);
+
+  if (!history.ReadRecord(val_iter, val_record)) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart for the time step " << val_iter << " in " << history.GetFileName() << "." << endl;
+    exit(EXIT_FAILURE);
+  }
+
+}
@@ -420,23 +420,17 @@ su2double CEulerVariable::GetProjVel(su2double *val_vector) {
 	return ProjVel;
 }
 
-bool CEulerVariable::SetPrimVar_Compressible(CFluidModel *FluidModel) {
+bool CEulerVariable::SetPrimVar_Compressible(su2double *TDState, CFluidModel *FluidModel) {
 	unsigned short iVar;
   bool check_dens = false, check_press = false, check_sos = false, check_temp = false, RightVol = true;
   
-
-  SetVelocity();   // Computes velocity and velocity^2
-  su2double density = GetDensity();
-  su2double staticEnergy = GetEnergy()-0.5*Velocity2;
-  
-  /*--- Check will be moved inside fluid model plus error description strings ---*/
-  
-  FluidModel->SetTDState_rhoe(density, staticEnergy);
+  /*--- The velocity and the thermodynamic state (TDState) have already been
+   computed by the solver, with one call to the fluid model for all the points ---*/
   
   check_dens = SetDensity();
-  check_press = SetPressure(FluidModel->GetPressure());
-  check_sos = SetSoundSpeed(FluidModel->GetSoundSpeed2());
-  check_temp = SetTemperature(FluidModel->GetTemperature());
+  check_press = SetPressure(TDState[TD_PRESSURE]);
+  check_sos = SetSoundSpeed(TDState[TD_SOUNDSPEED2]);
+  check_temp = SetTemperature(TDState[TD_TEMPERATURE]);
   
   /*--- Check that the solution has a physical meaning ---*/
   
@@ -447,18 +441,20 @@ bool CEulerVariable::SetPrimVar_Compressible(CFluidModel *FluidModel) {
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] = Solution_Old[iVar];
     
-    /*--- Recompute the primitive variables ---*/
+    /*--- Recompute the primitive variables, the state of the point
+     is overwritten for the secondary variables ---*/
     
     SetVelocity();   // Computes velocity and velocity^2
     su2double density = GetDensity();
     su2double staticEnergy = GetEnergy()-0.5*Velocity2;
     /* check will be moved inside fluid model plus error description strings*/
     FluidModel->SetTDState_rhoe(density, staticEnergy);
+    FluidModel->GetTDState(TDState);
 
     SetDensity();
-    SetPressure(FluidModel->GetPressure());
-    SetSoundSpeed(FluidModel->GetSoundSpeed2());
-    SetTemperature(FluidModel->GetTemperature());
+    SetPressure(TDState[TD_PRESSURE]);
+    SetSoundSpeed(TDState[TD_SOUNDSPEED2]);
+    SetTemperature(TDState[TD_TEMPERATURE]);
     
     RightVol = false;
     
@@ -472,12 +468,12 @@ bool CEulerVariable::SetPrimVar_Compressible(CFluidModel *FluidModel) {
   
 }
 
-void CEulerVariable::SetSecondaryVar_Compressible(CFluidModel *FluidModel) {
+void CEulerVariable::SetSecondaryVar_Compressible(su2double *TDState) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
 
-   SetdPdrho_e(FluidModel->GetdPdrho_e());
-   SetdPde_rho(FluidModel->GetdPde_rho());
+   SetdPdrho_e(TDState[TD_DPDRHO_E]);
+   SetdPde_rho(TDState[TD_DPDE_RHO]);
 
 }
 
@@ -625,26 +621,20 @@ bool CNSVariable::SetStrainMag(bool val_limiter) {
   
 }
 
-bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) {
+bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke, su2double *TDState, su2double *Transport, CFluidModel *FluidModel) {
   
 	unsigned short iVar;
   su2double density, staticEnergy;
   bool check_dens = false, check_press = false, check_sos = false,
   check_temp = false, RightVol = true;
   
+  /*--- The velocity, the thermodynamic state (TDState) and the transport properties
+   have already been computed by the solver, with one call to the fluid model for all the points ---*/
   
-  SetVelocity(); // Computes velocity and velocity^2
-  density = GetDensity();
-  staticEnergy = GetEnergy()-0.5*Velocity2 - turb_ke;
-
-  /*--- Check will be moved inside fluid model plus error description strings ---*/
-  
-  FluidModel->SetTDState_rhoe(density, staticEnergy);
-
   check_dens  = SetDensity();
-  check_press = SetPressure(FluidModel->GetPressure());
-  check_sos   = SetSoundSpeed(FluidModel->GetSoundSpeed2());
-  check_temp  = SetTemperature(FluidModel->GetTemperature());
+  check_press = SetPressure(TDState[TD_PRESSURE]);
+  check_sos   = SetSoundSpeed(TDState[TD_SOUNDSPEED2]);
+  check_temp  = SetTemperature(TDState[TD_TEMPERATURE]);
   
   /*--- Check that the solution has a physical meaning ---*/
   
@@ -655,7 +645,8 @@ bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] = Solution_Old[iVar];
     
-    /*--- Recompute the primitive variables ---*/
+    /*--- Recompute the primitive variables, the state of the point
+     is overwritten for the secondary variables ---*/
     
     SetVelocity(); // Computes velocity and velocity^2
     density = GetDensity();
@@ -664,11 +655,13 @@ bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke
     /*--- Check will be moved inside fluid model plus error description strings ---*/
     
     FluidModel->SetTDState_rhoe(density, staticEnergy);
+    FluidModel->GetTDState(TDState);
+    FluidModel->SetTransport_Batch(1, &density, TDState, Transport);
     
     SetDensity();
-    SetPressure(FluidModel->GetPressure());
-    SetSoundSpeed(FluidModel->GetSoundSpeed2());
-    SetTemperature(FluidModel->GetTemperature());
+    SetPressure(TDState[TD_PRESSURE]);
+    SetSoundSpeed(TDState[TD_SOUNDSPEED2]);
+    SetTemperature(TDState[TD_TEMPERATURE]);
     
     RightVol = false;
     
@@ -680,7 +673,7 @@ bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke
   
   /*--- Set laminar viscosity ---*/
   
-  SetLaminarViscosity(FluidModel->GetLaminarViscosity());
+  SetLaminarViscosity(Transport[TR_VISCOSITY]);
   
   /*--- Set eddy viscosity ---*/
   
@@ -688,33 +681,33 @@ bool CNSVariable::SetPrimVar_Compressible(su2double eddy_visc, su2double turb_ke
 
   /*--- Set thermal conductivity ---*/
   
-  SetThermalConductivity(FluidModel->GetThermalConductivity());
+  SetThermalConductivity(Transport[TR_CONDUCTIVITY]);
 
   /*--- Set specific heat ---*/
 
-  SetSpecificHeatCp(FluidModel->GetCp());
+  SetSpecificHeatCp(TDState[TD_CP]);
   
   return RightVol;
   
 }
 
-void CNSVariable::SetSecondaryVar_Compressible(CFluidModel *FluidModel) {
+void CNSVariable::SetSecondaryVar_Compressible(su2double *TDState, su2double *Transport) {
 
     /*--- Compute secondary thermodynamic properties (partial derivatives...) ---*/
 
-	SetdPdrho_e( FluidModel->GetdPdrho_e() );
-	SetdPde_rho( FluidModel->GetdPde_rho() );
+	SetdPdrho_e( TDState[TD_DPDRHO_E] );
+	SetdPde_rho( TDState[TD_DPDE_RHO] );
 
-	SetdTdrho_e( FluidModel->GetdTdrho_e() );
-	SetdTde_rho( FluidModel->GetdTde_rho() );
+	SetdTdrho_e( TDState[TD_DTDRHO_E] );
+	SetdTde_rho( TDState[TD_DTDE_RHO] );
 
     /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
 
-	Setdmudrho_T( FluidModel->Getdmudrho_T() );
-	SetdmudT_rho( FluidModel->GetdmudT_rho() );
+	Setdmudrho_T( Transport[TR_DMUDRHO_T] );
+	SetdmudT_rho( Transport[TR_DMUDT_RHO] );
 
-	Setdktdrho_T( FluidModel->Getdktdrho_T() );
-	SetdktdT_rho( FluidModel->GetdktdT_rho() );
+	Setdktdrho_T( Transport[TR_DKTDRHO_T] );
+	SetdktdT_rho( Transport[TR_DKTDT_RHO] );
 
 }
 
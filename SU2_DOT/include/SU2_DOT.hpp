@@ -67,6 +67,17 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
 void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, ofstream& Gradient_file);
 
+/*!
+ * \brief Sensitivity of the objective function to the displacement of a vertex of a design surface.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] val_marker - Index of the marker.
+ * \param[in] val_vertex - Index of the vertex.
+ * \param[out] val_sens - Sensitivity in each direction.
+ */
+
+void GetVertex_Sensitivity(CGeometry *geometry, CConfig *config, unsigned short val_marker, unsigned long val_vertex, su2double *val_sens);
+
 /*!
  * \brief Prints the gradient information to a file.
  * \param[in] Gradient - The gradient data.
@@ -238,12 +238,12 @@ int main(int argc, char *argv[]) {
 
 void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, ofstream& Gradient_file){
 
-  unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
-  unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, **Gradient, *Normal, dS, *VarCoord, Sensitivity,
-      dalpha[3], deps[3], dalpha_deps;
-  bool *UpdatePoint;
+  unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim, nDim, iOrder, jOrder, kOrder;
+  unsigned long iVertex, iPoint, iSurfacePoints, iControlPoint, nControlPoint;
+  su2double delta_eps, *my_Gradient, *all_Gradient, **Gradient, *Normal, dS, *VarCoord, Sensitivity, *Coord;
+  bool *UpdatePoint, FFD_Read = false;
   CFreeFormDefBox **FFDBox;
+  vector<su2double> *Vertex_Sens, *Control_Sens, *Control_Coord, Surface_Sens;
 
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
@@ -251,6 +251,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 #endif
 
   nDV = config->GetnDV();
+  nDim = geometry->GetnDim();
 
   /*--- Boolean controlling points to be updated ---*/
 
@@ -264,6 +265,8 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   /*--- Structure to store the gradient ---*/
 
   Gradient = new su2double*[nDV];
+  my_Gradient = new su2double[nDV];
+  all_Gradient = new su2double[nDV];
 
   for (iDV = 0; iDV  < nDV; iDV++){
     nDV_Value = config->GetnDV_Value(iDV);
@@ -272,12 +275,49 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
       exit(EXIT_FAILURE);
     }
     Gradient[iDV] = new su2double[nDV_Value];
+    my_Gradient[iDV] = 0.0;
     }
 
   /*--- Continuous adjoint gradient computation ---*/
   if (rank == MASTER_NODE)
     cout << "Evaluate functional gradient using Finite Differences." << endl;
 
+  /*--- The sensitivity projected on the normal of each vertex is the same for all
+   the design variables, it is computed once (each point only counts once) ---*/
+
+  Vertex_Sens = new vector<su2double>[config->GetnMarker_All()];
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    UpdatePoint[iPoint] = true;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) == YES) {
+      Vertex_Sens[iMarker].assign(nDim*geometry->nVertex[iMarker], 0.0);
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
+
+          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+
+          dS = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dS += Normal[iDim]*Normal[iDim];
+          dS = sqrt(dS);
+
+          for (iDim = 0; iDim < nDim; iDim++)
+            Vertex_Sens[iMarker][nDim*iVertex+iDim] = -Sensitivity*Normal[iDim]/dS;
+
+          UpdatePoint[iPoint] = false;
+        }
+      }
+    }
+  }
+
+  Control_Sens = new vector<su2double>[nFFDBox];
+  Control_Coord = new vector<su2double>[nFFDBox];
+
   for (iDV = 0; iDV < nDV; iDV++) {
 
       /*--- Free Form deformation based ---*/
@@ -292,9 +332,9 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
         (config->GetDesign_Variable(iDV) == FFD_CAMBER) ||
         (config->GetDesign_Variable(iDV) == FFD_THICKNESS) ) {
 
-        /*--- Read the FFD information in the first iteration ---*/
+        /*--- Read the FFD information with the first FFD design variable ---*/
 
-        if (iDV == 0) {
+        if (!FFD_Read) {
 
           if (rank == MASTER_NODE)
             cout << "Read the FFD information from mesh file." << endl;
@@ -317,11 +357,43 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
           surface_movement->CheckFFDIntersections(geometry, config, FFDBox[iFFDBox], iFFDBox);
 
+            /*--- The surface displacement is linear in the control points (basis operator),
+             so the sensitivity of the control points is computed once with the transposed
+             operator, and each design variable only needs the displacement of the control points ---*/
+
+            Surface_Sens.assign(3*FFDBox[iFFDBox]->GetnSurfacePoint(), 0.0);
+            for (iSurfacePoints = 0; iSurfacePoints < FFDBox[iFFDBox]->GetnSurfacePoint(); iSurfacePoints++) {
+              iMarker = FFDBox[iFFDBox]->Get_MarkerIndex(iSurfacePoints);
+              if (config->GetMarker_All_DV(iMarker) != YES) continue;
+              iVertex = FFDBox[iFFDBox]->Get_VertexIndex(iSurfacePoints);
+              for (iDim = 0; iDim < nDim; iDim++)
+                Surface_Sens[3*iSurfacePoints+iDim] = Vertex_Sens[iMarker][nDim*iVertex+iDim];
+            }
+
+            nControlPoint = FFDBox[iFFDBox]->GetlOrder()*FFDBox[iFFDBox]->GetmOrder()*FFDBox[iFFDBox]->GetnOrder();
+            Control_Sens[iFFDBox].assign(3*nControlPoint, 0.0);
+            if (FFDBox[iFFDBox]->GetnSurfacePoint() != 0)
+              FFDBox[iFFDBox]->GetBasis_TransposedProduct(&Surface_Sens[0], &Control_Sens[iFFDBox][0]);
+
+            /*--- Original position of the control points ---*/
+
+            Control_Coord[iFFDBox].assign(3*nControlPoint, 0.0);
+            for (iOrder = 0; iOrder < FFDBox[iFFDBox]->GetlOrder(); iOrder++)
+              for (jOrder = 0; jOrder < FFDBox[iFFDBox]->GetmOrder(); jOrder++)
+                for (kOrder = 0; kOrder < FFDBox[iFFDBox]->GetnOrder(); kOrder++) {
+                  iControlPoint = (iOrder*FFDBox[iFFDBox]->GetmOrder()+jOrder)*FFDBox[iFFDBox]->GetnOrder()+kOrder;
+                  Coord = FFDBox[iFFDBox]->GetCoordControlPoints(iOrder, jOrder, kOrder);
+                  for (iDim = 0; iDim < 3; iDim++)
+                    Control_Coord[iFFDBox][3*iControlPoint+iDim] = Coord[iDim];
+                }
+
           }
 
           if (rank == MASTER_NODE)
             cout <<"-------------------------------------------------------------------------" << endl;
 
+          FFD_Read = true;
+
         }
 
         /*--- Apply the control point change ---*/
@@ -343,105 +415,99 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
           case FFD_CONTROL_SURFACE :  surface_movement->SetFFDControl_Surface(geometry, config, FFDBox[iFFDBox], iDV, true); break;
           }
 
-          /*--- Recompute cartesian coordinates using the new control points position ---*/
+          /*--- Projection, dot product of the sensitivity and the displacement of the control points ---*/
 
-        surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox);
+          for (iOrder = 0; iOrder < FFDBox[iFFDBox]->GetlOrder(); iOrder++)
+            for (jOrder = 0; jOrder < FFDBox[iFFDBox]->GetmOrder(); jOrder++)
+              for (kOrder = 0; kOrder < FFDBox[iFFDBox]->GetnOrder(); kOrder++) {
+                iControlPoint = (iOrder*FFDBox[iFFDBox]->GetmOrder()+jOrder)*FFDBox[iFFDBox]->GetnOrder()+kOrder;
+                Coord = FFDBox[iFFDBox]->GetCoordControlPoints(iOrder, jOrder, kOrder);
+                for (iDim = 0; iDim < 3; iDim++)
+                  my_Gradient[iDV] += Control_Sens[iFFDBox][3*iControlPoint+iDim]*
+                  (Coord[iDim] - Control_Coord[iFFDBox][3*iControlPoint+iDim]);
+              }
 
         }
 
       }
 
+    else {
+
       /*--- Hicks Henne design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == HICKS_HENNE) {
-      surface_movement->SetHicksHenne(geometry, config, iDV, true);
+      if (config->GetDesign_Variable(iDV) == HICKS_HENNE) {
+        surface_movement->SetHicksHenne(geometry, config, iDV, true);
       }
 
       /*--- Displacement design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == TRANSLATION) {
-      surface_movement->SetTranslation(geometry, config, iDV, true);
+      else if (config->GetDesign_Variable(iDV) == TRANSLATION) {
+        surface_movement->SetTranslation(geometry, config, iDV, true);
       }
 
       /*--- Scale design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == SCALE) {
-      surface_movement->SetScale(geometry, config, iDV, true);
+      else if (config->GetDesign_Variable(iDV) == SCALE) {
+        surface_movement->SetScale(geometry, config, iDV, true);
       }
 
       /*--- Rotation design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == ROTATION) {
-      surface_movement->SetRotation(geometry, config, iDV, true);
+      else if (config->GetDesign_Variable(iDV) == ROTATION) {
+        surface_movement->SetRotation(geometry, config, iDV, true);
       }
 
       /*--- NACA_4Digits design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == NACA_4DIGITS) {
-      surface_movement->SetNACA_4Digits(geometry, config);
+      else if (config->GetDesign_Variable(iDV) == NACA_4DIGITS) {
+        surface_movement->SetNACA_4Digits(geometry, config);
       }
 
       /*--- Parabolic design variable ---*/
 
-    else if (config->GetDesign_Variable(iDV) == PARABOLIC) {
-      surface_movement->SetParabolic(geometry, config);
+      else if (config->GetDesign_Variable(iDV) == PARABOLIC) {
+        surface_movement->SetParabolic(geometry, config);
       }
 
       else if (config->GetDesign_Variable(iDV) == CUSTOM){
-	if (rank == MASTER_NODE)
-       	  cout <<"Custom design variable will be used in external script" << endl;
+        if (rank == MASTER_NODE)
+          cout <<"Custom design variable will be used in external script" << endl;
       }
+
       /*--- Design variable not implement ---*/
 
       else { cout << "Design Variable not implement yet" << endl; }
 
-      /*--- Load the delta change in the design variable (finite difference step). ---*/
+      /*--- Projection, dot product of the sensitivity and the displacement of the vertices ---*/
 
-    delta_eps = config->GetDV_Value(iDV);
-    my_Gradient = 0.0; Gradient[iDV][0] = 0.0;
-      
-      /*--- Reset update points ---*/
-
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-        UpdatePoint[iPoint] = true;
-      
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetMarker_All_DV(iMarker) == YES) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+        if (config->GetMarker_All_DV(iMarker) == YES) {
+          for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+            VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+            for (iDim = 0; iDim < nDim; iDim++)
+              my_Gradient[iDV] += Vertex_Sens[iMarker][nDim*iVertex+iDim]*VarCoord[iDim];
+          }
+        }
+      }
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
+    }
 
-            Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-            VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-            Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+    /*--- Load the delta change in the design variable (finite difference step). ---*/
 
-              dS = 0.0;
-            for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                dS += Normal[iDim]*Normal[iDim];
-                deps[iDim] = VarCoord[iDim] / delta_eps;
-              }
-              dS = sqrt(dS);
+    delta_eps = config->GetDV_Value(iDV);
+    my_Gradient[iDV] /= delta_eps;
 
-              dalpha_deps = 0.0;
-            for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                dalpha[iDim] = Normal[iDim] / dS;
-                dalpha_deps -= dalpha[iDim]*deps[iDim];
-              }
+  }
 
-              my_Gradient += Sensitivity*dalpha_deps;
-              UpdatePoint[iPoint] = false;
-            }
-          }
-        }
-      }
+  /*--- A single reduction for all the design variables ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &Gradient[iDV][0], 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(my_Gradient, all_Gradient, nDV, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
-    Gradient[iDV][0] = my_Gradient;
+  for (iDV = 0; iDV < nDV; iDV++) all_Gradient[iDV] = my_Gradient[iDV];
 #endif
-  }
+
+  for (iDV = 0; iDV < nDV; iDV++) Gradient[iDV][0] = all_Gradient[iDV];
 
   /* --- Print gradients to screen and file ---*/
 
@@ -451,16 +517,23 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     delete [] Gradient[iDV];
         }
   delete [] Gradient;
+  delete [] my_Gradient;
+  delete [] all_Gradient;
   delete [] UpdatePoint;
+  delete [] Vertex_Sens;
+  delete [] Control_Sens;
+  delete [] Control_Coord;
 
 }
 
 
 void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, ofstream& Gradient_file){
 
-  su2double DV_Value, *VarCoord, Sensitivity, **Gradient, my_Gradient, *Normal, Area = 0.0;
-  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value;
-  unsigned long iVertex, nVertex, iPoint;
+  su2double DV_Value, *VarCoord, Sensitivity[3] = {0.0, 0.0, 0.0}, **Gradient, my_Gradient, *Coord;
+  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value, iFFDBox, iOrder, jOrder, kOrder;
+  unsigned long iVertex, nVertex, iSurfacePoints, iControlPoint;
+  CFreeFormDefBox *FFDBox;
+  vector<su2double> Surface_Sens, Control_Sens;
 
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
@@ -512,9 +585,12 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     }
   }
   
-  /*--- Call the surface deformation routine ---*/
+  /*--- Call the surface deformation routine. The surface points of the FFD
+   boxes are not recorded, only their control points (see below) ---*/
 	
+  surface_movement->SetFFDSurfaceUpdate(false);
   surface_movement->SetSurface_Deformation(geometry, config);
+  surface_movement->SetFFDSurfaceUpdate(true);
 	
   /*--- Stop the recording --- */
     
@@ -527,27 +603,48 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     if (config->GetMarker_All_DV(iMarker) == YES) {
       nVertex = geometry->nVertex[iMarker];
       for (iVertex = 0; iVertex <nVertex; iVertex++) {
-        iPoint      = geometry->vertex[iMarker][iVertex]->GetNode();
         VarCoord    = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-        Normal      = geometry->vertex[iMarker][iVertex]->GetNormal();
-
-        Area = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++){
-          Area += Normal[iDim]*Normal[iDim];
-        }
-        Area = sqrt(Area);
-
+        GetVertex_Sensitivity(geometry, config, iMarker, iVertex, Sensitivity);
         for (iDim = 0; iDim < nDim; iDim++){
-          if (config->GetDiscrete_Adjoint()){
-          Sensitivity = geometry->GetSensitivity(iPoint, iDim);
-          } else {
-            Sensitivity = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
-          }
-          SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity));
+          SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity[iDim]));
         }
       }
     }
   }
+  
+  /*--- The derivatives of the control points of the FFD boxes (without nesting)
+   are the transposed product of the basis operator and the sensitivities of the
+   surface points of the box ---*/
+  
+  for (iFFDBox = 0; iFFDBox < surface_movement->GetnFFDBox(); iFFDBox++) {
+    
+    FFDBox = surface_movement->GetFFDBox(iFFDBox);
+    if ((FFDBox->GetnParentFFDBox() != 0) || (FFDBox->GetnChildFFDBox() != 0)) continue;
+    
+    Surface_Sens.assign(3*FFDBox->GetnSurfacePoint(), 0.0);
+    for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+      iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+      if (config->GetMarker_All_DV(iMarker) != YES) continue;
+      GetVertex_Sensitivity(geometry, config, iMarker, FFDBox->Get_VertexIndex(iSurfacePoints), Sensitivity);
+      for (iDim = 0; iDim < nDim; iDim++)
+        Surface_Sens[3*iSurfacePoints+iDim] = Sensitivity[iDim];
+    }
+    
+    Control_Sens.assign(3*FFDBox->GetlOrder()*FFDBox->GetmOrder()*FFDBox->GetnOrder(), 0.0);
+    if (FFDBox->GetnSurfacePoint() != 0)
+      FFDBox->GetBasis_TransposedProduct(&Surface_Sens[0], &Control_Sens[0]);
+    
+    for (iOrder = 0; iOrder < FFDBox->GetlOrder(); iOrder++)
+      for (jOrder = 0; jOrder < FFDBox->GetmOrder(); jOrder++)
+        for (kOrder = 0; kOrder < FFDBox->GetnOrder(); kOrder++) {
+          iControlPoint = (iOrder*FFDBox->GetmOrder()+jOrder)*FFDBox->GetnOrder()+kOrder;
+          Coord = FFDBox->GetCoordControlPoints(iOrder, jOrder, kOrder);
+          for (iDim = 0; iDim < 3; iDim++)
+            SU2_TYPE::SetDerivative(Coord[iDim], SU2_TYPE::GetDerivative(Coord[iDim]) +
+                                    SU2_TYPE::GetValue(Control_Sens[3*iControlPoint+iDim]));
+        }
+    
+  }
     
   /*--- Compute derivatives and extract gradient ---*/
     
@@ -577,6 +674,27 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   delete [] Gradient;
 }
 
+void GetVertex_Sensitivity(CGeometry *geometry, CConfig *config, unsigned short val_marker, unsigned long val_vertex, su2double *val_sens){
+
+  unsigned short iDim, nDim = geometry->GetnDim();
+  unsigned long iPoint = geometry->vertex[val_marker][val_vertex]->GetNode();
+  su2double *Normal = geometry->vertex[val_marker][val_vertex]->GetNormal(), Area = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++){
+    Area += Normal[iDim]*Normal[iDim];
+  }
+  Area = sqrt(Area);
+
+  for (iDim = 0; iDim < nDim; iDim++){
+    if (config->GetDiscrete_Adjoint()){
+      val_sens[iDim] = geometry->GetSensitivity(iPoint, iDim);
+    } else {
+      val_sens[iDim] = -Normal[iDim]*geometry->vertex[val_marker][val_vertex]->GetAuxVar()/Area;
+    }
+  }
+
+}
+
 void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file){
 
   unsigned short nDV, iDV, iDV_Value, nDV_Value;
@@ -583,7 +583,7 @@ def get_gradFileFormat(grad_type,plot_format,kindID,special_cases=[]):
     # handle plot formating
     if   plot_format == 'TECPLOT': 
         header.append('VARIABLES=')
-    elif plot_format == 'PARAVIEW':
+    elif plot_format in ['PARAVIEW','PARAVIEW_BINARY','PARAVIEW_XML']:
         pass
     else: raise Exception('output plot format not recognized')
     
@@ -710,7 +710,7 @@ def get_optFileFormat(plot_format,special_cases=None):
     # handle plot formating
     if   plot_format == 'TECPLOT': 
         header_format = header_format + 'VARIABLES='
-    elif plot_format == 'PARAVIEW':
+    elif plot_format in ['PARAVIEW','PARAVIEW_BINARY','PARAVIEW_XML']:
         pass
     else: raise Exception('output plot format not recognized')
 
@@ -767,6 +767,8 @@ def get_optFileFormat(plot_format,special_cases=None):
 def get_extension(output_format):
   
     if (output_format == "PARAVIEW")        : return ".csv"
+    if (output_format == "PARAVIEW_BINARY") : return ".csv"
+    if (output_format == "PARAVIEW_XML")    : return ".csv"
     if (output_format == "TECPLOT")         : return ".dat"
     if (output_format == "TECPLOT_BINARY")  : return ".plt"
     if (output_format == "SOLUTION")        : return ".dat"  